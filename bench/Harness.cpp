@@ -0,0 +1,265 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   Harness.cpp                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: marvin <marvin@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 21:18:37 by marvin            #+#    #+#             */
+/*   Updated: 2026/10/18 14:12:30 by marvin           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "Harness.hpp"
+#include <iostream>
+#include <iomanip>
+#include <sstream>
+#include <algorithm>
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+#include <fcntl.h>
+#include <time.h>
+#include <unistd.h>
+
+// Throws everything away, for discardCout().
+class NullBuffer : public std::streambuf
+{
+   protected:
+      int overflow(int c)
+      {
+         return c;
+      }
+      std::streamsize xsputn(const char*, std::streamsize n)
+      {
+         return n;
+      }
+};
+
+static NullBuffer g_null;
+
+double harness_now_ns(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+static unsigned long long read_cycles(void)
+{
+#if defined(__x86_64__) || defined(__i386__)
+    return __builtin_ia32_rdtsc();
+#elif defined(__aarch64__)
+    unsigned long long value;
+
+    __asm__ __volatile__("mrs %0, cntvct_el0" : "=r"(value));
+    return value;
+#else
+    return 0;
+#endif
+}
+
+// Nearest-rank percentile of an already sorted sample.
+static double percentile(const std::vector<double>& sorted, double p)
+{
+    std::size_t rank;
+
+    if (sorted.empty())
+        return 0;
+    rank = static_cast<std::size_t>(p / 100.0 * sorted.size() + 0.999999);
+    if (rank == 0)
+        rank = 1;
+    if (rank > sorted.size())
+        rank = sorted.size();
+    return sorted[rank - 1];
+}
+
+static void write_all(int fd, const std::string& text)
+{
+    const char* data;
+    std::size_t len;
+    ssize_t     put;
+
+    data = text.data();
+    len = text.length();
+    while (len > 0)
+    {
+        put = write(fd, data, len);
+        if (put < 0 && errno == EINTR)
+            continue;
+        if (put <= 0)
+            return;
+        data += put;
+        len -= put;
+    }
+}
+
+// Flags: --reps N, --warmup N, --filter SUBSTRING. Any other
+// "--flag value" pair is left for option().
+Harness::Harness(const std::string& suite, int ac, char **av)
+    : suite(suite), ac(ac), av(av), warmup(3), reps(30), saved_cout(NULL)
+{
+    int i;
+
+    i = 1;
+    while (i + 1 < ac)
+    {
+        if (std::strcmp(av[i], "--reps") == 0)
+            reps = std::strtoul(av[i + 1], NULL, 10);
+        else if (std::strcmp(av[i], "--warmup") == 0)
+            warmup = std::strtoul(av[i + 1], NULL, 10);
+        else if (std::strcmp(av[i], "--filter") == 0)
+            filter = av[i + 1];
+        i += 2;
+    }
+    if (reps == 0)
+        reps = 1;
+    std::cout.flush();
+    json_fd = dup(1);
+    devnull = open("/dev/null", O_WRONLY);
+    if (devnull >= 0)
+        dup2(devnull, 1);
+}
+
+Harness::~Harness()
+{
+    discardCout(false);
+    std::cout.flush();
+    if (json_fd >= 0)
+    {
+        dup2(json_fd, 1);
+        close(json_fd);
+    }
+    if (devnull >= 0)
+        close(devnull);
+}
+
+// The suite's own "--flag value" option, or fallback when it is absent.
+unsigned long Harness::option(const char* flag, unsigned long fallback) const
+{
+    int i;
+
+    i = 1;
+    while (i + 1 < ac)
+    {
+        if (std::strcmp(av[i], flag) == 0)
+            return std::strtoul(av[i + 1], NULL, 10);
+        i += 2;
+    }
+    return fallback;
+}
+
+// While on, std::cout drops its output before it reaches fd 1, so a case
+// times the code that formats the output rather than the write() calls.
+void Harness::discardCout(bool on)
+{
+    std::cout.flush();
+    if (on && !saved_cout)
+        saved_cout = std::cout.rdbuf(&g_null);
+    else if (!on && saved_cout)
+    {
+        std::cout.rdbuf(saved_cout);
+        saved_cout = NULL;
+    }
+}
+
+void Harness::run(const std::string& name, Case fn, void* ctx,
+                  unsigned long batch, std::size_t bytes_per_op,
+                  unsigned long ops_per_call)
+{
+    Result              result;
+    unsigned int        rep;
+    unsigned long       i;
+    double              t0;
+    double              elapsed;
+    double              ops;
+    unsigned long long  c0;
+    unsigned long long  cycles;
+
+    if (!filter.empty() && name.find(filter) == std::string::npos)
+        return;
+    if (batch == 0)
+        batch = 1;
+    if (ops_per_call == 0)
+        ops_per_call = 1;
+    result.name = name;
+    result.batch = batch;
+    result.ops = ops_per_call;
+    result.bytes = bytes_per_op;
+    ops = static_cast<double>(batch) * ops_per_call;
+    rep = 0;
+    while (rep < warmup + reps)
+    {
+        t0 = harness_now_ns();
+        c0 = read_cycles();
+        i = 0;
+        while (i < batch)
+        {
+            fn(ctx);
+            i++;
+        }
+        std::cout.flush();
+        cycles = read_cycles() - c0;
+        elapsed = harness_now_ns() - t0;
+        if (rep >= warmup)
+        {
+            result.ns.push_back(elapsed / ops);
+            result.cycles.push_back(static_cast<double>(cycles) / ops);
+        }
+        rep++;
+    }
+    std::sort(result.ns.begin(), result.ns.end());
+    std::sort(result.cycles.begin(), result.cycles.end());
+    std::cerr << std::left << std::setw(12) << suite << std::setw(36) << name
+              << std::right << std::fixed << std::setprecision(1)
+              << std::setw(12) << percentile(result.ns, 50) << " ns/op p50"
+              << std::setw(12) << percentile(result.ns, 99) << " p99\n";
+    results.push_back(result);
+}
+
+// Prints one JSON object for the suite and returns the exit status.
+int Harness::finish(void)
+{
+    std::ostringstream  out;
+    std::size_t         i;
+    double              sum;
+    std::size_t         j;
+
+    out << std::fixed << std::setprecision(2);
+    out << "{\"suite\": \"" << suite << "\", \"warmup\": " << warmup
+        << ", \"reps\": " << reps << ", \"results\": [";
+    i = 0;
+    while (i < results.size())
+    {
+        const Result& r = results[i];
+
+        sum = 0;
+        j = 0;
+        while (j < r.ns.size())
+        {
+            sum += r.ns[j];
+            j++;
+        }
+        out << (i ? ",\n  " : "\n  ")
+            << "{\"name\": \"" << r.name << "\", \"batch\": " << r.batch
+            << ", \"ops_per_call\": " << r.ops
+            << ", \"ns_per_op\": {\"min\": " << r.ns.front()
+            << ", \"mean\": " << sum / r.ns.size()
+            << ", \"p50\": " << percentile(r.ns, 50)
+            << ", \"p90\": " << percentile(r.ns, 90)
+            << ", \"p99\": " << percentile(r.ns, 99)
+            << ", \"max\": " << r.ns.back() << "}"
+            << ", \"cycles_per_op\": {\"min\": " << r.cycles.front()
+            << ", \"p50\": " << percentile(r.cycles, 50)
+            << ", \"p99\": " << percentile(r.cycles, 99) << "}";
+        if (r.bytes)
+            out << ", \"mb_per_s_p50\": "
+                << r.bytes / percentile(r.ns, 50) * 1e3;
+        out << "}";
+        i++;
+    }
+    out << "\n]}\n";
+    write_all(json_fd >= 0 ? json_fd : 2, out.str());
+    return 0;
+}
@@ -0,0 +1,78 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   Harness.hpp                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: marvin <marvin@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 21:18:37 by marvin            #+#    #+#             */
+/*   Updated: 2026/10/18 14:12:30 by marvin           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef HARNESS_HPP
+#define HARNESS_HPP
+
+#include <string>
+#include <vector>
+#include <streambuf>
+#include <cstddef>
+
+// Runs each case for warmup + reps repetitions of batch calls and keeps
+// one ns/op and one cycles/op sample per measured repetition. While the
+// suite runs, fd 1 points at /dev/null, so the exercises' std::cout
+// output costs a real write() without reaching the terminal, unless
+// discardCout() drops it before the write(). The JSON goes to the
+// original stdout and a summary table to stderr.
+//
+// When one call of a case does ops_per_call units of work (a whole
+// horde, one tick over every human), the samples are per unit.
+// Cycles come from the time-stamp counter (rdtsc on x86, cntvct_el0 on
+// arm64), which counts at a fixed rate, not the core clock. Elsewhere
+// they are reported as 0.
+class Harness
+{
+   public:
+      typedef void (*Case)(void* ctx);
+
+   private:
+      struct Result
+      {
+         std::string          name;
+         unsigned long        batch;
+         unsigned long        ops;
+         std::size_t          bytes;
+         std::vector<double>  ns;
+         std::vector<double>  cycles;
+      };
+
+      std::string          suite;
+      int                  ac;
+      char                 **av;
+      unsigned int         warmup;
+      unsigned int         reps;
+      std::string          filter;
+      int                  json_fd;
+      int                  devnull;
+      std::streambuf*      saved_cout;
+      std::vector<Result>  results;
+
+      Harness(const Harness&);
+      Harness& operator=(const Harness&);
+
+   public:
+      Harness(const std::string& suite, int ac, char **av);
+      ~Harness();
+
+      unsigned long  option(const char* flag,
+                            unsigned long fallback) const;
+      void           discardCout(bool on);
+      void           run(const std::string& name, Case fn, void* ctx,
+                         unsigned long batch, std::size_t bytes_per_op = 0,
+                         unsigned long ops_per_call = 1);
+      int            finish(void);
+};
+
+double harness_now_ns(void);
+
+#endif
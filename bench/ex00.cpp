@@ -0,0 +1,37 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ex00.cpp                                           :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: marvin <marvin@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 21:18:37 by marvin            #+#    #+#             */
+/*   Updated: 2026/10/17 21:18:37 by marvin           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "Harness.hpp"
+#include "../ex00/Zombie.hpp"
+
+static void heap_zombie(void*)
+{
+    Zombie* z;
+
+    z = newZombie("HeapZombie");
+    z->announce();
+    delete z;
+}
+
+static void stack_zombie(void*)
+{
+    randomChump("StackZombie");
+}
+
+int main(int ac, char **av)
+{
+    Harness harness("ex00", ac, av);
+
+    harness.run("newZombie+announce+delete", &heap_zombie, NULL, 10000);
+    harness.run("randomChump", &stack_zombie, NULL, 10000);
+    return harness.finish();
+}
@@ -0,0 +1,43 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ex01.cpp                                           :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: marvin <marvin@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 21:18:37 by marvin            #+#    #+#             */
+/*   Updated: 2026/10/18 14:12:30 by marvin           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "Harness.hpp"
+#include "../ex01/Zombie.hpp"
+#include <sstream>
+
+static void horde(void* ctx)
+{
+    int     n;
+    Zombie* zombies;
+
+    n = *static_cast<int*>(ctx);
+    zombies = zombieHorde(n, "HordeZombie");
+    delete[] zombies;
+}
+
+int main(int ac, char **av)
+{
+    static int          sizes[] = {10, 1000, 100000};
+    Harness             harness("ex01", ac, av);
+    std::ostringstream  name;
+    unsigned int        i;
+
+    i = 0;
+    while (i < sizeof(sizes) / sizeof(*sizes))
+    {
+        name.str("");
+        name << "zombieHorde+delete[] N=" << sizes[i];
+        harness.run(name.str(), &horde, &sizes[i], 100000 / sizes[i]);
+        i++;
+    }
+    return harness.finish();
+}
@@ -0,0 +1,41 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ex03.cpp                                           :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: marvin <marvin@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 21:18:37 by marvin            #+#    #+#             */
+/*   Updated: 2026/10/17 21:18:37 by marvin           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "Harness.hpp"
+#include "../ex03/Weapon.hpp"
+#include "../ex03/HumanA.hpp"
+#include "../ex03/HumanB.hpp"
+
+static void human_a(void* ctx)
+{
+    static_cast<HumanA*>(ctx)->attack();
+}
+
+static void human_b(void* ctx)
+{
+    static_cast<HumanB*>(ctx)->attack();
+}
+
+int main(int ac, char **av)
+{
+    Harness harness("ex03", ac, av);
+    Weapon  club("crude spiked club");
+    HumanA  bob("Bob", club);
+    HumanB  jim("Jim");
+    HumanB  ann("Ann");
+
+    jim.setWeapon(club);
+    harness.run("HumanA::attack", &human_a, &bob, 10000);
+    harness.run("HumanB::attack armed", &human_b, &jim, 10000);
+    harness.run("HumanB::attack unarmed", &human_b, &ann, 10000);
+    return harness.finish();
+}
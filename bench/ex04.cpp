@@ -0,0 +1,56 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ex04.cpp                                           :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: marvin <marvin@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 21:18:37 by marvin            #+#    #+#             */
+/*   Updated: 2026/10/17 21:18:37 by marvin           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "Harness.hpp"
+#include "../ex04/Sed.hpp"
+#include "../ex04/bench/Corpus.hpp"
+
+struct ReplaceCase
+{
+    std::string text;
+    std::string s1;
+    std::string s2;
+    std::string out;
+};
+
+static void replace(void* ctx)
+{
+    ReplaceCase* c;
+
+    c = static_cast<ReplaceCase*>(ctx);
+    build_replaced(c->text, c->s1, c->s2, c->out);
+}
+
+// 1 MiB of the sedbench corpus at its default density, and one with ten
+// times as many matches.
+int main(int ac, char **av)
+{
+    Harness     harness("ex04", ac, av);
+    CorpusSpec  spec;
+    ReplaceCase sparse;
+    ReplaceCase dense;
+
+    default_corpus_spec(spec);
+    spec.size = 1 << 20;
+    generate_corpus(spec, sparse.text);
+    sparse.s1 = corpus_pattern(spec);
+    sparse.s2 = "replacement";
+    spec.density *= 10;
+    generate_corpus(spec, dense.text);
+    dense.s1 = sparse.s1;
+    dense.s2 = sparse.s2;
+    harness.run("build_replaced 1MiB 1/KiB", &replace, &sparse, 10,
+                sparse.text.length());
+    harness.run("build_replaced 1MiB 10/KiB", &replace, &dense, 10,
+                dense.text.length());
+    return harness.finish();
+}
@@ -0,0 +1,47 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ex05.cpp                                           :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: marvin <marvin@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 21:18:37 by marvin            #+#    #+#             */
+/*   Updated: 2026/10/18 14:12:30 by marvin           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "Harness.hpp"
+#include "../ex05/Harl.hpp"
+#include <string>
+
+struct ComplainCase
+{
+    Harl        harl;
+    std::string level;
+};
+
+static void complain(void* ctx)
+{
+    ComplainCase* c;
+
+    c = static_cast<ComplainCase*>(ctx);
+    c->harl.complain(c->level);
+}
+
+int main(int ac, char **av)
+{
+    static const char*  levels[] = {"DEBUG", "INFO", "WARNING", "ERROR",
+                                    "NOTHING"};
+    Harness             harness("ex05", ac, av);
+    ComplainCase        c;
+    unsigned int        i;
+
+    i = 0;
+    while (i < sizeof(levels) / sizeof(*levels))
+    {
+        c.level = levels[i];
+        harness.run("Harl::complain " + c.level, &complain, &c, 10000);
+        i++;
+    }
+    return harness.finish();
+}
@@ -6,15 +6,14 @@
 /*   By: marvin <marvin@student.42.fr>              +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2026/01/10 20:13:50 by marvin            #+#    #+#             */
-/*   Updated: 2026/01/10 20:13:50 by marvin           ###   ########.fr       */
+/*   Updated: 2026/10/17 16:58:10 by marvin           ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
 #include "Zombie.hpp"
 
-Zombie::Zombie(std::string name)
+Zombie::Zombie(const std::string& name) : name(name)
 {
-   this->name = name;
 }
 
 void  Zombie::announce(void)
@@ -6,7 +6,7 @@
 /*   By: marvin <marvin@student.42.fr>              +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2026/01/10 20:40:27 by marvin            #+#    #+#             */
-/*   Updated: 2026/01/10 20:40:27 by marvin           ###   ########.fr       */
+/*   Updated: 2026/10/17 16:58:10 by marvin           ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -22,7 +22,7 @@ class Zombie
       std::string name;
 
    public:
-      Zombie(std::string name);
+      Zombie(const std::string& name);
       ~Zombie();
 
       void announce(void);
@@ -0,0 +1,177 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ZombiePool.cpp                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: marvin <marvin@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 16:21:33 by marvin            #+#    #+#             */
+/*   Updated: 2026/10/18 15:04:22 by marvin           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "ZombiePool.hpp"
+#include <new>
+#include <pthread.h>
+
+ZombiePool::ZombiePool(std::size_t slots_per_slab)
+   : slots_per_slab(slots_per_slab ? slots_per_slab : 1), slab(0), used(0),
+     free_list(NULL)
+{
+   counters.allocations = 0;
+   counters.releases = 0;
+   counters.live = 0;
+   counters.peak_live = 0;
+   counters.resets = 0;
+   counters.slabs = 0;
+   counters.bytes_reserved = 0;
+}
+
+ZombiePool::~ZombiePool()
+{
+   std::size_t i;
+
+   reset();
+   i = 0;
+   while (i < slabs.size())
+   {
+      delete[] slabs[i];
+      i++;
+   }
+}
+
+ZombiePool::Slot* ZombiePool::take(void)
+{
+   Slot* slot;
+
+   if (free_list)
+   {
+      slot = free_list;
+      free_list = slot->next;
+      return slot;
+   }
+   if (used == slots_per_slab && slab + 1 < slabs.size())
+   {
+      slab++;
+      used = 0;
+   }
+   if (slabs.empty() || used == slots_per_slab)
+   {
+      slabs.push_back(new Slot[slots_per_slab]());
+      slab = slabs.size() - 1;
+      used = 0;
+      counters.slabs++;
+      counters.bytes_reserved += slots_per_slab * sizeof(Slot);
+   }
+   return &slabs[slab][used++];
+}
+
+Zombie* ZombiePool::create(const std::string& name)
+{
+   Slot*    slot;
+   Zombie*  zombie;
+
+   slot = take();
+   try
+   {
+      zombie = new (slot->storage.bytes) Zombie(name);
+   }
+   catch (...)
+   {
+      slot->live = false;
+      slot->next = free_list;
+      free_list = slot;
+      throw;
+   }
+   slot->live = true;
+   counters.allocations++;
+   if (++counters.live > counters.peak_live)
+      counters.peak_live = counters.live;
+   return zombie;
+}
+
+void ZombiePool::release(Zombie* zombie)
+{
+   Slot* slot;
+
+   if (!zombie)
+      return;
+   slot = reinterpret_cast<Slot*>(zombie);
+   if (!slot->live)
+      return;
+   zombie->~Zombie();
+   slot->live = false;
+   slot->next = free_list;
+   free_list = slot;
+   counters.releases++;
+   counters.live--;
+}
+
+// Zombie owns a std::string, so each live one still has to be destroyed;
+// the cost is one pass over the slots handed out since the last reset.
+// Nothing goes back to the heap and the free list is simply dropped.
+void ZombiePool::reset(void)
+{
+   std::size_t i;
+   std::size_t j;
+   std::size_t end;
+
+   i = 0;
+   while (i < slabs.size() && i <= slab)
+   {
+      end = (i == slab) ? used : slots_per_slab;
+      j = 0;
+      while (j < end)
+      {
+         if (slabs[i][j].live)
+         {
+            reinterpret_cast<Zombie*>(slabs[i][j].storage.bytes)->~Zombie();
+            slabs[i][j].live = false;
+            counters.releases++;
+         }
+         j++;
+      }
+      i++;
+   }
+   slab = 0;
+   used = 0;
+   free_list = NULL;
+   counters.live = 0;
+   counters.resets++;
+}
+
+const ZombiePoolStats& ZombiePool::stats(void) const
+{
+   return counters;
+}
+
+static pthread_key_t    g_pool_key;
+static pthread_once_t   g_pool_once = PTHREAD_ONCE_INIT;
+
+static void destroy_local_pool(void* pool)
+{
+   delete static_cast<ZombiePool*>(pool);
+}
+
+static void make_pool_key(void)
+{
+   pthread_key_create(&g_pool_key, &destroy_local_pool);
+}
+
+// One pool per thread, created on first use and destroyed at thread exit.
+// Key destructors do not run for the main thread when main() returns, so
+// its pool is reclaimed by the OS without reset(): call reset() first if
+// the remaining zombies must be destroyed.
+ZombiePool& ZombiePool::local(void)
+{
+   ZombiePool* pool;
+
+   pthread_once(&g_pool_once, &make_pool_key);
+   pool = static_cast<ZombiePool*>(pthread_getspecific(g_pool_key));
+   if (!pool)
+   {
+      pool = new ZombiePool();
+      pthread_setspecific(g_pool_key, pool);
+   }
+   return *pool;
+}
@@ -0,0 +1,84 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ZombiePool.hpp                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: marvin <marvin@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 16:21:33 by marvin            #+#    #+#             */
+/*   Updated: 2026/10/18 15:04:22 by marvin           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef ZOMBIEPOOL_HPP
+#define ZOMBIEPOOL_HPP
+
+#include <string>
+#include <vector>
+#include <cstddef>
+#include "Zombie.hpp"
+
+struct ZombiePoolStats
+{
+   unsigned long  allocations;
+   unsigned long  releases;
+   unsigned long  live;
+   unsigned long  peak_live;
+   unsigned long  resets;
+   unsigned long  slabs;
+   std::size_t    bytes_reserved;
+};
+
+// Hands out Zombies from slabs of slots_per_slab slots. Released slots go
+// on a free list and are reused before the bump pointer moves on. reset()
+// destroys every live Zombie and rewinds the pool without freeing a slab;
+// the slabs themselves are returned only by the destructor.
+class ZombiePool
+{
+   private:
+      union Storage
+      {
+         char        bytes[sizeof(Zombie)];
+         void*       align_ptr;
+         long long   align_ll;
+         double      align_d;
+      };
+
+      struct Slot
+      {
+         Storage  storage;
+         Slot*    next;
+         bool     live;
+      };
+
+      std::vector<Slot*>   slabs;
+      std::size_t          slots_per_slab;
+      std::size_t          slab;
+      std::size_t          used;
+      Slot*                free_list;
+      ZombiePoolStats      counters;
+
+      ZombiePool(const ZombiePool&);
+      ZombiePool& operator=(const ZombiePool&);
+
+      Slot* take(void);
+
+   public:
+      ZombiePool(std::size_t slots_per_slab = 1024);
+      ~ZombiePool();
+
+      Zombie*                 create(const std::string& name);
+      // A second release() of the same zombie is ignored only while its
+      // slot has not been handed out again; once create() reuses the slot,
+      // a stale pointer releases the new zombie.
+      void                    release(Zombie* zombie);
+      void                    reset(void);
+      const ZombiePoolStats&  stats(void) const;
+
+      // Per-thread pool; the main thread's is never destroyed.
+      static ZombiePool&      local(void);
+};
+
+Zombie* newZombie(std::string name, ZombiePool& pool);
+
+#endif
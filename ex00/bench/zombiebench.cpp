@@ -0,0 +1,108 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   zombiebench.cpp                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: marvin <marvin@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 16:21:33 by marvin            #+#    #+#             */
+/*   Updated: 2026/10/18 14:12:30 by marvin           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../bench/Harness.hpp"
+#include "../Zombie.hpp"
+#include "../ZombiePool.hpp"
+#include <iostream>
+#include <vector>
+
+struct PoolCase
+{
+    ZombiePool              pool;
+    std::vector<Zombie*>    live;
+    std::string             name;
+};
+
+// Each call creates live.size() zombies, then gets rid of all of them.
+static void heap_batch(void* ctx)
+{
+    PoolCase*   c;
+    std::size_t i;
+
+    c = static_cast<PoolCase*>(ctx);
+    i = 0;
+    while (i < c->live.size())
+    {
+        c->live[i] = newZombie(c->name);
+        i++;
+    }
+    i = 0;
+    while (i < c->live.size())
+    {
+        delete c->live[i];
+        i++;
+    }
+}
+
+static void pool_release(void* ctx)
+{
+    PoolCase*   c;
+    std::size_t i;
+
+    c = static_cast<PoolCase*>(ctx);
+    i = 0;
+    while (i < c->live.size())
+    {
+        c->live[i] = newZombie(c->name, c->pool);
+        i++;
+    }
+    i = 0;
+    while (i < c->live.size())
+    {
+        c->pool.release(c->live[i]);
+        i++;
+    }
+}
+
+static void pool_reset(void* ctx)
+{
+    PoolCase*   c;
+    std::size_t i;
+
+    c = static_cast<PoolCase*>(ctx);
+    i = 0;
+    while (i < c->live.size())
+    {
+        newZombie(c->name, c->pool);
+        i++;
+    }
+    c->pool.reset();
+}
+
+// --batch N sets how many zombies are alive at once (1000 by default).
+// The Zombie messages are discarded, so this times allocation alone.
+int main(int ac, char **av)
+{
+    Harness         harness("zombiebench", ac, av);
+    PoolCase        c;
+    unsigned long   batch;
+
+    batch = harness.option("--batch", 1000);
+    if (batch == 0)
+        batch = 1;
+    c.name = "Zombie";
+    c.live.resize(batch);
+    harness.discardCout(true);
+    harness.run("new / delete", &heap_batch, &c, 100, 0, batch);
+    harness.run("ZombiePool create / release", &pool_release, &c, 100, 0,
+                batch);
+    harness.run("ZombiePool create / reset", &pool_reset, &c, 100, 0, batch);
+    harness.discardCout(false);
+    std::cerr << "  allocations " << c.pool.stats().allocations
+              << " releases " << c.pool.stats().releases
+              << " peak live " << c.pool.stats().peak_live
+              << " resets " << c.pool.stats().resets
+              << "\n  slabs " << c.pool.stats().slabs
+              << " bytes reserved " << c.pool.stats().bytes_reserved << "\n";
+    return harness.finish();
+}
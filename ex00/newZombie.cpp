@@ -6,14 +6,20 @@
 /*   By: marvin <marvin@student.42.fr>              +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2026/01/10 20:58:18 by marvin            #+#    #+#             */
-/*   Updated: 2026/01/10 20:58:18 by marvin           ###   ########.fr       */
+/*   Updated: 2026/10/17 16:21:33 by marvin           ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
 #include "Zombie.hpp"
+#include "ZombiePool.hpp"
 
 Zombie* newZombie(std::string name)
 {
    Zombie* z = new Zombie(name);
    return z;
-}
\ No newline at end of file
+}
+
+Zombie* newZombie(std::string name, ZombiePool& pool)
+{
+   return pool.create(name);
+}
@@ -0,0 +1,165 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   Horde.cpp                                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: marvin <marvin@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 17:34:52 by marvin            #+#    #+#             */
+/*   Updated: 2026/10/18 15:48:30 by marvin           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "Horde.hpp"
+#include "Zombie.hpp"
+#include "ZombieStats.hpp"
+#include <iostream>
+#include <cstring>
+#include <limits>
+#include <new>
+
+// Names come first in the block so they keep pointer alignment; the
+// alive flags follow them.
+Horde::Horde(std::size_t n, const std::string& name) : names(NULL),
+    alive(NULL), count(n)
+{
+    static const char   born[] = "A zombie is born.\n";
+    ZombieName          interned(name);
+    void*               block;
+    std::string         out;
+    std::size_t         i;
+
+    // The block size must not wrap, or the fill below would overrun it.
+    if (n > (std::numeric_limits<std::size_t>::max() - 1)
+            / (sizeof(ZombieName) + 1))
+        throw std::bad_alloc();
+    block = ::operator new(n * (sizeof(ZombieName) + 1) + 1);
+    names = static_cast<ZombieName*>(block);
+    alive = reinterpret_cast<unsigned char*>(names + n);
+    i = 0;
+    while (i < n)
+    {
+        new (names + i) ZombieName(interned);
+        i++;
+    }
+    std::memset(alive, 1, n);
+    Zombie::recordBirths(n);
+    if (Zombie::getLifecycle() != Zombie::PRINT)
+        return;
+    i = 0;
+    while (i < n)
+    {
+        out.append(born, sizeof(born) - 1);
+        if (out.length() >= ZOMBIE_WRITE_CHUNK)
+        {
+            zombie_write(out);
+            out.clear();
+        }
+        i++;
+    }
+    zombie_write(out);
+}
+
+Horde::~Horde()
+{
+    destroyRange(0, count);
+    ::operator delete(names);
+}
+
+std::size_t Horde::size(void) const
+{
+    return count;
+}
+
+bool Horde::isAlive(std::size_t i) const
+{
+    return i < count && alive[i];
+}
+
+const std::string& Horde::name(std::size_t i) const
+{
+    return names[i].str();
+}
+
+void Horde::announce(std::size_t i) const
+{
+    if (isAlive(i))
+        std::cout << names[i].str() << ": BraiiiiiiinnnzzzZ..." << std::endl;
+}
+
+void Horde::announceAll(void) const
+{
+    std::string out;
+    std::size_t i;
+
+    i = 0;
+    while (i < count)
+    {
+        if (alive[i])
+        {
+            out += names[i].str();
+            out += ": BraiiiiiiinnnzzzZ...\n";
+        }
+        if (out.length() >= ZOMBIE_WRITE_CHUNK)
+        {
+            zombie_write(out);
+            out.clear();
+        }
+        i++;
+    }
+    zombie_write(out);
+}
+
+void Horde::rename(std::size_t i, const std::string& name)
+{
+    if (i < count)
+        names[i] = ZombieName(name);
+}
+
+void Horde::renameAll(const std::string& name)
+{
+    ZombieName  interned(name);
+    std::size_t i;
+
+    i = 0;
+    while (i < count)
+    {
+        names[i] = interned;
+        i++;
+    }
+}
+
+// ZombieName is a bare handle, so a dead zombie only needs its flag
+// cleared; the slot stays valid until the horde is freed.
+void Horde::destroyRange(std::size_t first, std::size_t last)
+{
+    std::string     out;
+    std::size_t     i;
+    unsigned long   killed;
+
+    if (last > count)
+        last = count;
+    killed = 0;
+    i = first;
+    while (i < last)
+    {
+        if (alive[i])
+        {
+            if (Zombie::getLifecycle() == Zombie::PRINT)
+            {
+                out += names[i].str();
+                out += " is destroyed\n";
+            }
+            alive[i] = 0;
+            killed++;
+        }
+        if (out.length() >= ZOMBIE_WRITE_CHUNK)
+        {
+            zombie_write(out);
+            out.clear();
+        }
+        i++;
+    }
+    Zombie::recordDeaths(killed);
+    zombie_write(out);
+}
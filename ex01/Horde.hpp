@@ -0,0 +1,48 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   Horde.hpp                                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: marvin <marvin@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 17:34:52 by marvin            #+#    #+#             */
+/*   Updated: 2026/10/17 18:12:27 by marvin           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef HORDE_HPP
+#define HORDE_HPP
+
+#include <string>
+#include <cstddef>
+#include "ZombieName.hpp"
+
+// N zombies kept as parallel arrays (one name handle and one alive flag
+// each) inside a single allocation. Zombies are born already named and
+// follow Zombie::getLifecycle() for their birth and death messages.
+class Horde
+{
+	private:
+		ZombieName*		names;
+		unsigned char*	alive;
+		std::size_t		count;
+
+		Horde(const Horde&);
+		Horde& operator=(const Horde&);
+
+	public:
+		Horde(std::size_t n, const std::string& name);
+		~Horde();
+
+		std::size_t			size(void) const;
+		bool				isAlive(std::size_t i) const;
+		const std::string&	name(std::size_t i) const;
+
+		void	announce(std::size_t i) const;
+		void	announceAll(void) const;
+		void	rename(std::size_t i, const std::string& name);
+		void	renameAll(const std::string& name);
+		void	destroyRange(std::size_t first, std::size_t last);
+};
+
+#endif
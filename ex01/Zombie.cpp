@@ -6,30 +6,83 @@
 /*   By: marvin <marvin@student.42.fr>              +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2026/01/10 23:27:02 by marvin            #+#    #+#             */
-/*   Updated: 2026/01/10 23:27:02 by marvin           ###   ########.fr       */
+/*   Updated: 2026/10/18 13:31:47 by marvin           ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
 #include "Zombie.hpp"
+#include "ZombieStats.hpp"
 #include <iostream>
 
+Zombie::Lifecycle   Zombie::lifecycle = Zombie::PRINT;
+
 Zombie::Zombie()
 {
-   std::cout << "A zombie is born." << std::endl;
+   ZOMBIE_TIMED(CONSTRUCT);
+   recordBirths(1);
+   if (lifecycle == PRINT)
+      std::cout << "A zombie is born." << std::endl;
 }
 
 Zombie::~Zombie()
 {
-    std::cout << name << " is destroyed" << std::endl;
+    ZOMBIE_TIMED(DESTROY);
+    recordDeaths(1);
+    if (lifecycle == PRINT)
+        std::cout << name.str() << " is destroyed" << std::endl;
+}
+
+void Zombie::setLifecycle(Lifecycle mode)
+{
+    lifecycle = mode;
+}
+
+Zombie::Lifecycle Zombie::getLifecycle(void)
+{
+    return lifecycle;
+}
+
+// The only place births and deaths are counted, so ZombieStats and
+// births()/deaths() can never disagree.
+void Zombie::recordBirths(unsigned long n)
+{
+    if (ZOMBIE_STATS >= 1 || lifecycle == COUNT)
+        ZombieStats::constructed(n);
+}
+
+void Zombie::recordDeaths(unsigned long n)
+{
+    if (ZOMBIE_STATS >= 1 || lifecycle == COUNT)
+        ZombieStats::destroyed(n);
+}
+
+unsigned long Zombie::births(void)
+{
+    return ZombieStats::constructedCount();
+}
+
+unsigned long Zombie::deaths(void)
+{
+    return ZombieStats::destroyedCount();
+}
+
+const std::string& Zombie::getName(void) const
+{
+    return name.str();
+}
+
+void Zombie::setName(const std::string& new_name)
+{
+   name = ZombieName(new_name);
 }
 
-void Zombie::setName(std::string new_name)
+void Zombie::setName(const ZombieName& new_name)
 {
    name = new_name;
 }
 
 void Zombie::announce(void)
 {
-    std::cout << name << ": BraiiiiiiinnnzzzZ..." << std::endl;
+    std::cout << name.str() << ": BraiiiiiiinnnzzzZ..." << std::endl;
 }
 
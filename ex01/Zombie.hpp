@@ -6,7 +6,7 @@
 /*   By: marvin <marvin@student.42.fr>              +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2026/01/10 23:20:54 by marvin            #+#    #+#             */
-/*   Updated: 2026/01/10 23:20:54 by marvin           ###   ########.fr       */
+/*   Updated: 2026/10/18 13:31:47 by marvin           ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -14,20 +14,49 @@
 #define ZOMBIE_HPP
 
 #include <string>
+#include "ZombieName.hpp"
+
+// Batched output is handed to write() whenever it reaches this size.
+#define ZOMBIE_WRITE_CHUNK (1 << 20)
 
 class Zombie
 {
+	public:
+		// PRINT is the normal behaviour; COUNT only bumps births()/deaths();
+		// SILENT does neither. The counts are kept by ZombieStats, which
+		// also counts in every mode when built with ZOMBIE_STATS >= 1.
+		enum Lifecycle
+		{
+			PRINT,
+			COUNT,
+			SILENT
+		};
+
 	private:
-		std::string name;
+		ZombieName name;
+
+		static Lifecycle		lifecycle;
 
 	public:
 		Zombie();
 		~Zombie();
 
-		void setName(std::string new_name);
+		static void				setLifecycle(Lifecycle mode);
+		static Lifecycle		getLifecycle(void);
+		static void				recordBirths(unsigned long n);
+		static void				recordDeaths(unsigned long n);
+		static unsigned long	births(void);
+		static unsigned long	deaths(void);
+
+		const std::string& getName(void) const;
+
+		void setName(const std::string& new_name);
+		void setName(const ZombieName& new_name);
 		void announce(void);
 };
 
 Zombie* zombieHorde(int N, std::string name);
+void    announceAll(const Zombie* horde, int n);
+void    zombie_write(const std::string& text);
 
 #endif
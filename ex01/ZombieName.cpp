@@ -0,0 +1,68 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ZombieName.cpp                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: marvin <marvin@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 16:58:10 by marvin            #+#    #+#             */
+/*   Updated: 2026/10/18 13:31:47 by marvin           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "ZombieName.hpp"
+#include <set>
+
+// Function-local so the table exists before any static Zombie needs it.
+static std::set<std::string>& name_table(void)
+{
+    static std::set<std::string> table;
+
+    return table;
+}
+
+static const std::string* empty_name(void)
+{
+    static const std::string* empty = &*name_table().insert("").first;
+
+    return empty;
+}
+
+ZombieName::ZombieName() : interned(empty_name())
+{
+}
+
+ZombieName::ZombieName(const std::string& name)
+    : interned(&*name_table().insert(name).first)
+{
+}
+
+const std::string& ZombieName::str(void) const
+{
+    return *interned;
+}
+
+bool ZombieName::operator==(const ZombieName& other) const
+{
+    return interned == other.interned;
+}
+
+std::size_t ZombieName::tableSize(void)
+{
+    return name_table().size();
+}
+
+std::size_t ZombieName::tableBytes(void)
+{
+    std::set<std::string>::const_iterator   it;
+    std::size_t                             bytes;
+
+    bytes = 0;
+    it = name_table().begin();
+    while (it != name_table().end())
+    {
+        bytes += it->length();
+        ++it;
+    }
+    return bytes;
+}
@@ -0,0 +1,39 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ZombieName.hpp                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: marvin <marvin@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 16:58:10 by marvin            #+#    #+#             */
+/*   Updated: 2026/10/17 20:41:16 by marvin           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef ZOMBIENAME_HPP
+#define ZOMBIENAME_HPP
+
+#include <string>
+#include <cstddef>
+
+// A handle to a name stored once in a process-wide table. Copying one is
+// a pointer copy, so a horde sharing a name holds a single string.
+// Interned names live until the program exits. The table is not locked;
+// intern from one thread at a time.
+class ZombieName
+{
+	private:
+		const std::string*	interned;
+
+	public:
+		ZombieName();
+		explicit ZombieName(const std::string& name);
+
+		const std::string&	str(void) const;
+		bool				operator==(const ZombieName& other) const;
+
+		static std::size_t	tableSize(void);
+		static std::size_t	tableBytes(void);
+};
+
+#endif
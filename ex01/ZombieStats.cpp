@@ -0,0 +1,174 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ZombieStats.cpp                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: marvin <marvin@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 20:41:16 by marvin            #+#    #+#             */
+/*   Updated: 2026/10/18 13:31:47 by marvin           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "ZombieStats.hpp"
+#include "ZombieName.hpp"
+#include <iostream>
+#include <fstream>
+#include <cstdlib>
+#include <time.h>
+
+unsigned long   ZombieStats::born = 0;
+unsigned long   ZombieStats::died = 0;
+unsigned long   ZombieStats::peak = 0;
+ZombieHistogram ZombieStats::timers[ZombieStats::TIMER_COUNT];
+
+static const char* const g_timer_names[ZombieStats::TIMER_COUNT] = {
+    "construct",
+    "destroy",
+    "zombieHorde"
+};
+
+static void dump_at_exit(void)
+{
+    const char*     path;
+    std::ofstream   file;
+
+    path = std::getenv("ZOMBIE_STATS_JSON");
+    if (path && *path)
+    {
+        file.open(path);
+        if (file)
+        {
+            ZombieStats::dumpJson(file);
+            return;
+        }
+    }
+    ZombieStats::dumpJson(std::cerr);
+}
+
+// Zombie's COUNT mode uses the counters in any build, so the JSON dump
+// is only armed when the stats were asked for at compile time.
+void ZombieStats::registerDump(void)
+{
+    static bool registered = false;
+
+    if (ZOMBIE_STATS >= 1 && !registered)
+    {
+        registered = true;
+        std::atexit(&dump_at_exit);
+    }
+}
+
+void ZombieStats::constructed(unsigned long n)
+{
+    registerDump();
+    born += n;
+    if (born - died > peak)
+        peak = born - died;
+}
+
+void ZombieStats::destroyed(unsigned long n)
+{
+    died += n;
+}
+
+void ZombieStats::record(Timer timer, unsigned long long ns)
+{
+    ZombieHistogram&    h = timers[timer];
+    int                 bucket;
+
+    registerDump();
+    bucket = 0;
+    while (bucket < 63 && (ns >> (bucket + 1)) != 0)
+        bucket++;
+    h.buckets[bucket]++;
+    h.count++;
+    h.total_ns += ns;
+    if (ns > h.max_ns)
+        h.max_ns = ns;
+}
+
+unsigned long ZombieStats::constructedCount(void)
+{
+    return born;
+}
+
+unsigned long ZombieStats::destroyedCount(void)
+{
+    return died;
+}
+
+unsigned long ZombieStats::live(void)
+{
+    return born - died;
+}
+
+unsigned long ZombieStats::peakLive(void)
+{
+    return peak;
+}
+
+// Interned name characters plus one handle per live zombie.
+std::size_t ZombieStats::nameBytes(void)
+{
+    return ZombieName::tableBytes() + live() * sizeof(ZombieName);
+}
+
+const ZombieHistogram& ZombieStats::histogram(Timer timer)
+{
+    return timers[timer];
+}
+
+void ZombieStats::dumpJson(std::ostream& out)
+{
+    int i;
+    int last;
+    int b;
+
+    out << "{\"constructed\": " << born
+        << ", \"destroyed\": " << died
+        << ", \"live\": " << live()
+        << ", \"peak_live\": " << peak
+        << ", \"name_bytes\": " << nameBytes()
+        << ", \"timers\": {";
+    i = 0;
+    while (i < TIMER_COUNT)
+    {
+        last = 63;
+        while (last > 0 && timers[i].buckets[last] == 0)
+            last--;
+        out << (i ? ", " : "") << "\"" << g_timer_names[i] << "\": "
+            << "{\"count\": " << timers[i].count
+            << ", \"total_ns\": " << timers[i].total_ns
+            << ", \"max_ns\": " << timers[i].max_ns
+            << ", \"log2_ns_buckets\": [";
+        b = 0;
+        while (b <= last)
+        {
+            out << (b ? ", " : "") << timers[i].buckets[b];
+            b++;
+        }
+        out << "]}";
+        i++;
+    }
+    out << "}}" << std::endl;
+}
+
+unsigned long long zombie_now_ns(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return static_cast<unsigned long long>(ts.tv_sec) * 1000000000ULL
+        + ts.tv_nsec;
+}
+
+ZombieTimer::ZombieTimer(ZombieStats::Timer timer)
+    : timer(timer), start(zombie_now_ns())
+{
+}
+
+ZombieTimer::~ZombieTimer()
+{
+    ZombieStats::record(timer, zombie_now_ns() - start);
+}
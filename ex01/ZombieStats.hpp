@@ -0,0 +1,91 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ZombieStats.hpp                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: marvin <marvin@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 20:41:16 by marvin            #+#    #+#             */
+/*   Updated: 2026/10/18 13:31:47 by marvin           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef ZOMBIESTATS_HPP
+#define ZOMBIESTATS_HPP
+
+#include <ostream>
+#include <cstddef>
+
+// 0 compiles every hook out, 1 keeps the counters, 2 also times
+// construction, destruction and zombieHorde(). Build with
+// make re ZOMBIE_STATS=2. When enabled, the numbers are written as JSON
+// at exit to $ZOMBIE_STATS_JSON, or to stderr if it is unset.
+#ifndef ZOMBIE_STATS
+# define ZOMBIE_STATS 0
+#endif
+
+// Bucket i counts samples that took [2^i, 2^(i+1)) nanoseconds.
+struct ZombieHistogram
+{
+   unsigned long        buckets[64];
+   unsigned long        count;
+   unsigned long long   total_ns;
+   unsigned long long   max_ns;
+};
+
+class ZombieStats
+{
+   public:
+      enum Timer
+      {
+         CONSTRUCT,
+         DESTROY,
+         HORDE,
+         TIMER_COUNT
+      };
+
+   private:
+      static unsigned long    born;
+      static unsigned long    died;
+      static unsigned long    peak;
+      static ZombieHistogram  timers[TIMER_COUNT];
+
+      static void             registerDump(void);
+
+   public:
+      static void                   constructed(unsigned long n);
+      static void                   destroyed(unsigned long n);
+      static void                   record(Timer timer,
+                                           unsigned long long ns);
+
+      static unsigned long          constructedCount(void);
+      static unsigned long          destroyedCount(void);
+      static unsigned long          live(void);
+      static unsigned long          peakLive(void);
+      static std::size_t            nameBytes(void);
+      static const ZombieHistogram& histogram(Timer timer);
+
+      static void                   dumpJson(std::ostream& out);
+};
+
+unsigned long long zombie_now_ns(void);
+
+// Times the enclosing scope into one of the histograms.
+class ZombieTimer
+{
+   private:
+      ZombieStats::Timer   timer;
+      unsigned long long   start;
+
+   public:
+      ZombieTimer(ZombieStats::Timer timer);
+      ~ZombieTimer();
+};
+
+#if ZOMBIE_STATS >= 2
+# define ZOMBIE_TIMED(timer) ZombieTimer zombie_timer_(ZombieStats::timer)
+#else
+# define ZOMBIE_TIMED(timer) ((void)0)
+#endif
+
+#endif
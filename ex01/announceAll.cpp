@@ -0,0 +1,63 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   announceAll.cpp                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: marvin <marvin@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 18:12:27 by marvin            #+#    #+#             */
+/*   Updated: 2026/10/17 18:12:27 by marvin           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "Zombie.hpp"
+#include <iostream>
+#include <cerrno>
+#include <unistd.h>
+
+// Whatever std::cout still holds goes out first so lines stay in order.
+void zombie_write(const std::string& text)
+{
+    const char* data;
+    std::size_t len;
+    ssize_t     put;
+
+    std::cout.flush();
+    data = text.data();
+    len = text.length();
+    while (len > 0)
+    {
+        put = write(1, data, len);
+        if (put < 0 && errno == EINTR)
+            continue;
+        if (put <= 0)
+            return;
+        data += put;
+        len -= put;
+    }
+}
+
+// Same lines as calling announce() on each zombie, in one write() per
+// ZOMBIE_WRITE_CHUNK bytes of output.
+void announceAll(const Zombie* horde, int n)
+{
+    static const char   suffix[] = ": BraiiiiiiinnnzzzZ...\n";
+    std::string         out;
+    int                 i;
+
+    if (!horde || n <= 0)
+        return;
+    i = 0;
+    while (i < n)
+    {
+        out += horde[i].getName();
+        out.append(suffix, sizeof(suffix) - 1);
+        if (out.length() >= ZOMBIE_WRITE_CHUNK)
+        {
+            zombie_write(out);
+            out.clear();
+        }
+        i++;
+    }
+    zombie_write(out);
+}
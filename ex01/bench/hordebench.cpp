@@ -0,0 +1,104 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   hordebench.cpp                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: marvin <marvin@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 17:34:52 by marvin            #+#    #+#             */
+/*   Updated: 2026/10/18 14:12:30 by marvin           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../bench/Harness.hpp"
+#include "../Zombie.hpp"
+#include "../Horde.hpp"
+#include <iostream>
+#include <sstream>
+
+static void zombie_array(void* ctx)
+{
+    int     n;
+    int     i;
+    Zombie* zombies;
+
+    n = *static_cast<int*>(ctx);
+    zombies = zombieHorde(n, "HordeZombie");
+    i = 0;
+    while (i < n)
+    {
+        zombies[i].announce();
+        i++;
+    }
+    i = 0;
+    while (i < n)
+    {
+        zombies[i].setName("Renamed");
+        i++;
+    }
+    delete[] zombies;
+}
+
+static void counted_array(void* ctx)
+{
+    int     n;
+    int     i;
+    Zombie* zombies;
+
+    n = *static_cast<int*>(ctx);
+    Zombie::setLifecycle(Zombie::COUNT);
+    zombies = zombieHorde(n, "HordeZombie");
+    announceAll(zombies, n);
+    i = 0;
+    while (i < n)
+    {
+        zombies[i].setName("Renamed");
+        i++;
+    }
+    delete[] zombies;
+    Zombie::setLifecycle(Zombie::PRINT);
+}
+
+static void soa_horde(void* ctx)
+{
+    Horde   horde(*static_cast<int*>(ctx), "HordeZombie");
+
+    horde.announceAll();
+    horde.renameAll("Renamed");
+    horde.destroyRange(0, horde.size());
+}
+
+// Creates, announces, renames and destroys N zombies: a Zombie[] with
+// per-line std::endl, a Zombie[] counted instead of printed and announced
+// with announceAll(), and a Horde. N goes from 1000 to 10^max_exp, set
+// with --max-exp (5 by default).
+int main(int ac, char **av)
+{
+    Harness             harness("hordebench", ac, av);
+    std::ostringstream  name;
+    unsigned long       max_exp;
+    int                 max_n;
+    int                 n;
+
+    max_exp = harness.option("--max-exp", 5);
+    max_n = 1;
+    while (max_exp-- > 0)
+        max_n *= 10;
+    n = 1000;
+    while (n <= max_n)
+    {
+        name.str("");
+        name << "Zombie[] N=" << n;
+        harness.run(name.str(), &zombie_array, &n, 1, 0, n);
+        name.str("");
+        name << "counted N=" << n;
+        harness.run(name.str(), &counted_array, &n, 1, 0, n);
+        name.str("");
+        name << "Horde N=" << n;
+        harness.run(name.str(), &soa_horde, &n, 1, 0, n);
+        n *= 10;
+    }
+    std::cerr << "  Zombie[] " << sizeof(Zombie) << " B/zombie, Horde "
+              << sizeof(ZombieName) + 1 << " B/zombie\n";
+    return harness.finish();
+}
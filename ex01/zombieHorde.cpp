@@ -6,23 +6,27 @@
 /*   By: marvin <marvin@student.42.fr>              +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2026/01/10 23:36:14 by marvin            #+#    #+#             */
-/*   Updated: 2026/01/10 23:36:14 by marvin           ###   ########.fr       */
+/*   Updated: 2026/10/17 20:41:16 by marvin           ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
 #include "Zombie.hpp"
+#include "ZombieStats.hpp"
 
 Zombie* zombieHorde(int N, std::string name)
 {
+    ZOMBIE_TIMED(HORDE);
+
     if (N <= 0)
         return NULL;
 
     Zombie* horde = new Zombie[N];
+    ZombieName interned(name);
 
     int i = 0;
     while (i < N)
     {
-        horde[i].setName(name);
+        horde[i].setName(interned);
         i++;
     }
     return horde;
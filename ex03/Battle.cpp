@@ -0,0 +1,230 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   Battle.cpp                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: marvin <marvin@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 18:55:41 by marvin            #+#    #+#             */
+/*   Updated: 2026/10/18 13:16:05 by marvin           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "Battle.hpp"
+#include <cerrno>
+#include <unistd.h>
+
+static void write_all(int fd, const std::string& text)
+{
+    const char* data;
+    std::size_t len;
+    ssize_t     put;
+
+    data = text.data();
+    len = text.length();
+    while (len > 0)
+    {
+        put = write(fd, data, len);
+        if (put < 0 && errno == EINTR)
+            continue;
+        if (put <= 0)
+            return;
+        data += put;
+        len -= put;
+    }
+}
+
+// Shard 0 runs on the thread calling tick(), so threads - 1 workers are
+// started. If one fails to start, the pool stays at the workers we got.
+Battle::Battle(unsigned int threads, int fd)
+    : fd(fd), mode(TEXT), generation(0), pending(0), stopping(false),
+      total_attacks(0), total_unarmed(0)
+{
+    unsigned int    i;
+    pthread_t       thread;
+
+    if (threads == 0)
+        threads = 1;
+    shards.resize(threads);
+    i = 0;
+    while (i < threads)
+    {
+        shards[i].battle = this;
+        i++;
+    }
+    pthread_mutex_init(&lock, NULL);
+    pthread_cond_init(&start, NULL);
+    pthread_cond_init(&done, NULL);
+    i = 1;
+    while (i < threads)
+    {
+        if (pthread_create(&thread, NULL, &Battle::workerMain,
+                           &shards[i]) != 0)
+            break;
+        workers.push_back(thread);
+        i++;
+    }
+    shards.resize(workers.size() + 1);
+}
+
+Battle::~Battle()
+{
+    std::size_t i;
+
+    pthread_mutex_lock(&lock);
+    stopping = true;
+    pthread_cond_broadcast(&start);
+    pthread_mutex_unlock(&lock);
+    i = 0;
+    while (i < workers.size())
+    {
+        pthread_join(workers[i], NULL);
+        i++;
+    }
+    pthread_cond_destroy(&done);
+    pthread_cond_destroy(&start);
+    pthread_mutex_destroy(&lock);
+}
+
+void* Battle::workerMain(void* raw)
+{
+    Shard*          shard;
+    Battle*         battle;
+    unsigned long   seen;
+
+    shard = static_cast<Shard*>(raw);
+    battle = shard->battle;
+    seen = 0;
+    pthread_mutex_lock(&battle->lock);
+    while (true)
+    {
+        while (!battle->stopping && battle->generation == seen)
+            pthread_cond_wait(&battle->start, &battle->lock);
+        if (battle->stopping)
+            break;
+        seen = battle->generation;
+        pthread_mutex_unlock(&battle->lock);
+        battle->runShard(*shard);
+        pthread_mutex_lock(&battle->lock);
+        if (--battle->pending == 0)
+            pthread_cond_signal(&battle->done);
+    }
+    pthread_mutex_unlock(&battle->lock);
+    return NULL;
+}
+
+void Battle::runShard(Shard& shard)
+{
+    std::size_t i;
+
+    shard.attacks = 0;
+    shard.unarmed = 0;
+    shard.out.clear();
+    if (mode == COUNT)
+    {
+        i = shard.first;
+        while (i < shard.last)
+        {
+            if (weapons[i])
+                shard.attacks++;
+            i++;
+        }
+        shard.unarmed = (shard.last - shard.first) - shard.attacks;
+        return;
+    }
+    i = shard.first;
+    while (i < shard.last)
+    {
+        shard.out += names[i];
+        if (weapons[i])
+        {
+            shard.out += " attacks with their ";
+            shard.out += weapons[i]->getType();
+            shard.attacks++;
+        }
+        else
+        {
+            shard.out += " has no weapon";
+            shard.unarmed++;
+        }
+        shard.out += '\n';
+        i++;
+    }
+}
+
+std::size_t Battle::add(const std::string& name, const Weapon& weapon)
+{
+    names.push_back(name);
+    weapons.push_back(&weapon);
+    return names.size() - 1;
+}
+
+std::size_t Battle::add(const std::string& name)
+{
+    names.push_back(name);
+    weapons.push_back(NULL);
+    return names.size() - 1;
+}
+
+void Battle::setWeapon(std::size_t id, const Weapon& weapon)
+{
+    if (id < weapons.size())
+        weapons[id] = &weapon;
+}
+
+std::size_t Battle::size() const
+{
+    return names.size();
+}
+
+unsigned int Battle::threads() const
+{
+    return workers.size() + 1;
+}
+
+void Battle::tick(Output output)
+{
+    std::size_t     count;
+    std::size_t     i;
+    std::size_t     per;
+
+    count = names.size();
+    per = count / shards.size();
+    i = 0;
+    while (i < shards.size())
+    {
+        shards[i].first = i * per;
+        shards[i].last = (i + 1 < shards.size()) ? (i + 1) * per : count;
+        i++;
+    }
+    pthread_mutex_lock(&lock);
+    mode = output;
+    pending = workers.size();
+    generation++;
+    pthread_cond_broadcast(&start);
+    pthread_mutex_unlock(&lock);
+    runShard(shards[0]);
+    pthread_mutex_lock(&lock);
+    while (pending > 0)
+        pthread_cond_wait(&done, &lock);
+    pthread_mutex_unlock(&lock);
+    i = 0;
+    while (i < shards.size())
+    {
+        total_attacks += shards[i].attacks;
+        total_unarmed += shards[i].unarmed;
+        if (output == TEXT)
+            write_all(fd, shards[i].out);
+        i++;
+    }
+}
+
+unsigned long Battle::attacks() const
+{
+    return total_attacks;
+}
+
+unsigned long Battle::unarmed() const
+{
+    return total_unarmed;
+}
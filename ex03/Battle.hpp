@@ -0,0 +1,86 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   Battle.hpp                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: marvin <marvin@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 18:55:41 by marvin            #+#    #+#             */
+/*   Updated: 2026/10/17 20:02:50 by marvin           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef BATTLE_HPP
+#define BATTLE_HPP
+
+#include <string>
+#include <vector>
+#include <cstddef>
+#include <pthread.h>
+#include "Weapon.hpp"
+
+// Humans are kept as two parallel arrays, names and weapon pointers (NULL
+// for an unarmed HumanB). tick() makes every human attack once, split
+// into contiguous shards across a fixed pool of threads. In TEXT mode
+// each shard formats its lines exactly like HumanA/HumanB::attack into
+// its own buffer and the buffers are written to fd in order; in COUNT
+// mode shards only count. A weapon retyped mid-tick shows up with either
+// its old or its new type on each line.
+class Battle
+{
+public:
+    enum Output
+    {
+        TEXT,
+        COUNT
+    };
+
+private:
+    struct Shard
+    {
+        Battle*         battle;
+        std::size_t     first;
+        std::size_t     last;
+        std::string     out;
+        unsigned long   attacks;
+        unsigned long   unarmed;
+        char            pad[64];
+    };
+
+    std::vector<std::string>    names;
+    std::vector<const Weapon*>  weapons;
+    std::vector<Shard>          shards;
+    std::vector<pthread_t>      workers;
+    int                         fd;
+    Output                      mode;
+    unsigned long               generation;
+    unsigned int                pending;
+    bool                        stopping;
+    unsigned long               total_attacks;
+    unsigned long               total_unarmed;
+    pthread_mutex_t             lock;
+    pthread_cond_t              start;
+    pthread_cond_t              done;
+
+    Battle(const Battle&);
+    Battle& operator=(const Battle&);
+
+    static void*    workerMain(void* raw);
+    void            runShard(Shard& shard);
+
+public:
+    Battle(unsigned int threads = 1, int fd = 1);
+    ~Battle();
+
+    std::size_t     add(const std::string& name, const Weapon& weapon);
+    std::size_t     add(const std::string& name);
+    void            setWeapon(std::size_t id, const Weapon& weapon);
+    std::size_t     size() const;
+    unsigned int    threads() const;
+
+    void            tick(Output output = TEXT);
+    unsigned long   attacks() const;
+    unsigned long   unarmed() const;
+};
+
+#endif
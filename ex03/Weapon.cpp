@@ -6,23 +6,34 @@
 /*   By: marvin <marvin@student.42.fr>              +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2026/01/11 11:36:48 by marvin            #+#    #+#             */
-/*   Updated: 2026/01/11 11:36:48 by marvin           ###   ########.fr       */
+/*   Updated: 2026/10/17 20:02:50 by marvin           ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
 #include "Weapon.hpp"
 
-Weapon::Weapon(std::string type)
+Weapon::Weapon(const std::string& type) : type(type)
+{
+}
+
+Weapon::Weapon(const WeaponType& type) : type(type)
 {
-    this->type = type;
 }
 
 const std::string& Weapon::getType() const
 {
-    return this->type;
+    return this->type.str();
+}
+
+// The registry lookup happens first, so readers only ever see the
+// finished handle being swapped in.
+void Weapon::setType(const std::string& type)
+{
+    this->type = WeaponType(type);
 }
 
-void Weapon::setType(std::string type)
+// The hot-path form: a pointer copy, no lookup and no allocation.
+void Weapon::setType(const WeaponType& type)
 {
     this->type = type;
 }
@@ -6,7 +6,7 @@
 /*   By: marvin <marvin@student.42.fr>              +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2026/01/11 11:33:44 by marvin            #+#    #+#             */
-/*   Updated: 2026/01/11 11:33:44 by marvin           ###   ########.fr       */
+/*   Updated: 2026/10/17 20:02:50 by marvin           ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -14,17 +14,22 @@
 #define WEAPON_HPP
 
 #include <string>
+#include "WeaponType.hpp"
 
+// setType() may run while other threads call getType() or attack(); see
+// WeaponType for how readers stay wait-free.
 class Weapon
 {
 private:
-    std::string type;
+    WeaponType type;
 
 public:
-    Weapon(std::string type);
+    Weapon(const std::string& type);
+    Weapon(const WeaponType& type);
 
     const std::string& getType() const;
-    void setType(std::string type);
+    void setType(const std::string& type);
+    void setType(const WeaponType& type);
 };
 
 #endif
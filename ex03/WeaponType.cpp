@@ -0,0 +1,71 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   WeaponType.cpp                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: marvin <marvin@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 19:24:09 by marvin            #+#    #+#             */
+/*   Updated: 2026/10/17 20:02:50 by marvin           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "WeaponType.hpp"
+#include <set>
+#include <pthread.h>
+
+static pthread_mutex_t g_registry_lock = PTHREAD_MUTEX_INITIALIZER;
+
+// Function-local so the registry exists before any static Weapon needs it.
+static std::set<std::string>& registry()
+{
+    static std::set<std::string> types;
+
+    return types;
+}
+
+// set::insert only allocates for a type it has not seen, so re-interning
+// a known type costs a lookup and no allocation.
+WeaponType::WeaponType(const std::string& type)
+{
+    const std::string* found;
+
+    pthread_mutex_lock(&g_registry_lock);
+    found = &*registry().insert(type).first;
+    pthread_mutex_unlock(&g_registry_lock);
+    __atomic_store_n(&interned, found, __ATOMIC_RELEASE);
+}
+
+WeaponType::WeaponType(const WeaponType& other)
+    : interned(__atomic_load_n(&other.interned, __ATOMIC_ACQUIRE))
+{
+}
+
+WeaponType& WeaponType::operator=(const WeaponType& other)
+{
+    __atomic_store_n(&interned,
+                     __atomic_load_n(&other.interned, __ATOMIC_ACQUIRE),
+                     __ATOMIC_RELEASE);
+    return *this;
+}
+
+const std::string& WeaponType::str() const
+{
+    return *__atomic_load_n(&interned, __ATOMIC_ACQUIRE);
+}
+
+bool WeaponType::operator==(const WeaponType& other) const
+{
+    return __atomic_load_n(&interned, __ATOMIC_ACQUIRE)
+        == __atomic_load_n(&other.interned, __ATOMIC_ACQUIRE);
+}
+
+std::size_t WeaponType::registered()
+{
+    std::size_t count;
+
+    pthread_mutex_lock(&g_registry_lock);
+    count = registry().size();
+    pthread_mutex_unlock(&g_registry_lock);
+    return count;
+}
@@ -0,0 +1,44 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   WeaponType.hpp                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: marvin <marvin@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 19:24:09 by marvin            #+#    #+#             */
+/*   Updated: 2026/10/17 20:02:50 by marvin           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef WEAPONTYPE_HPP
+#define WEAPONTYPE_HPP
+
+#include <string>
+#include <cstddef>
+
+// A handle to a weapon type stored once in a shared registry. Copying or
+// assigning one is a pointer copy; only building one from a string looks
+// the registry up. Registered types live until the program exits.
+//
+// The pointer is published with a release store and read with an acquire
+// load. A handle can therefore be reassigned while other threads read
+// it: a reader gets either the old string or the new one, never a torn
+// one, without waiting. Strings are immutable and never freed, so there
+// is nothing to reclaim.
+class WeaponType
+{
+private:
+    const std::string* interned;
+
+public:
+    explicit WeaponType(const std::string& type);
+    WeaponType(const WeaponType& other);
+    WeaponType& operator=(const WeaponType& other);
+
+    const std::string&  str() const;
+    bool                operator==(const WeaponType& other) const;
+
+    static std::size_t  registered();
+};
+
+#endif
@@ -0,0 +1,282 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   battlebench.cpp                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: marvin <marvin@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 18:55:41 by marvin            #+#    #+#             */
+/*   Updated: 2026/10/18 15:55:17 by marvin           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../bench/Harness.hpp"
+#include "../Weapon.hpp"
+#include "../HumanA.hpp"
+#include "../HumanB.hpp"
+#include "../Battle.hpp"
+#include <iostream>
+#include <iomanip>
+#include <sstream>
+#include <vector>
+#include <pthread.h>
+
+struct SetTypeCase
+{
+    Weapon*             weapon;
+    const std::string*  names[2];
+    const WeaponType*   types[2];
+    unsigned long       i;
+};
+
+static void set_type_string(void* ctx)
+{
+    SetTypeCase* c;
+
+    c = static_cast<SetTypeCase*>(ctx);
+    c->weapon->setType(*c->names[++c->i & 1]);
+}
+
+static void set_type_registered(void* ctx)
+{
+    SetTypeCase* c;
+
+    c = static_cast<SetTypeCase*>(ctx);
+    c->weapon->setType(*c->types[++c->i & 1]);
+}
+
+struct MixArg
+{
+    Weapon*             weapon;
+    const WeaponType*   types[2];
+    std::string*        locked_type;
+    const std::string*  names[2];
+    pthread_mutex_t*    lock;
+    unsigned long       ops;
+    unsigned long       sink;
+};
+
+// 99 reads to 1 write against a Weapon shared by every thread.
+static void* mix_worker(void* raw)
+{
+    MixArg*         arg;
+    unsigned long   i;
+
+    arg = static_cast<MixArg*>(raw);
+    arg->sink = 0;
+    i = 0;
+    while (i < arg->ops)
+    {
+        if (i % 100 == 0)
+            arg->weapon->setType(*arg->types[(i / 100) & 1]);
+        else
+            arg->sink += arg->weapon->getType().length();
+        i++;
+    }
+    return NULL;
+}
+
+// The same mix with the type behind a mutex, the usual fix for the race.
+static void* mix_locked_worker(void* raw)
+{
+    MixArg*         arg;
+    unsigned long   i;
+
+    arg = static_cast<MixArg*>(raw);
+    arg->sink = 0;
+    i = 0;
+    while (i < arg->ops)
+    {
+        pthread_mutex_lock(arg->lock);
+        if (i % 100 == 0)
+            *arg->locked_type = *arg->names[(i / 100) & 1];
+        else
+            arg->sink += arg->locked_type->length();
+        pthread_mutex_unlock(arg->lock);
+        i++;
+    }
+    return NULL;
+}
+
+struct MixCase
+{
+    void*           (*worker)(void*);
+    MixArg          proto;
+    unsigned int    threads;
+    bool            failed;
+};
+
+// Joins whatever was started; a thread that could not be created marks
+// the case as failed, since its timing covers less work than reported.
+static void run_mix(void* ctx)
+{
+    MixCase*                c;
+    std::vector<pthread_t>  ids;
+    std::vector<MixArg>     args;
+    unsigned int            started;
+    unsigned int            i;
+
+    c = static_cast<MixCase*>(ctx);
+    ids.resize(c->threads);
+    args.assign(c->threads, c->proto);
+    started = 0;
+    while (started < c->threads
+           && pthread_create(&ids[started], NULL, c->worker,
+                             &args[started]) == 0)
+        started++;
+    if (started < c->threads)
+        c->failed = true;
+    i = 0;
+    while (i < started)
+    {
+        pthread_join(ids[i], NULL);
+        i++;
+    }
+}
+
+static void human_attack(void* ctx)
+{
+    static_cast<HumanA*>(ctx)->attack();
+}
+
+struct TickCase
+{
+    Battle*         battle;
+    Battle::Output  output;
+};
+
+static void tick(void* ctx)
+{
+    TickCase* c;
+
+    c = static_cast<TickCase*>(ctx);
+    c->battle->tick(c->output);
+}
+
+// --humans N (1000000 by default) is the work done by one call of the
+// threaded cases: N mixed reads and writes, or one Battle tick over N
+// humans. The baseline is HumanA::attack() with std::endl.
+int main(int ac, char **av)
+{
+    static const unsigned int   thread_counts[] = {1, 2, 4, 8, 16};
+    Harness                     harness("battlebench", ac, av);
+    unsigned long               humans;
+    unsigned long               i;
+    unsigned long               t;
+    std::vector<Weapon>         weapons;
+    std::ostringstream          name;
+
+    humans = harness.option("--humans", 1000000);
+    if (humans == 0)
+        humans = 1;
+    i = 0;
+    while (i < 32)
+    {
+        name.str("");
+        name << "weapon type " << i;
+        weapons.push_back(Weapon(name.str()));
+        i++;
+    }
+
+    {
+        Weapon      weapon(weapons[0]);
+        std::string a("crude spiked club");
+        std::string b("some other type of club");
+        WeaponType  ta(a);
+        WeaponType  tb(b);
+        SetTypeCase c;
+
+        c.weapon = &weapon;
+        c.names[0] = &a;
+        c.names[1] = &b;
+        c.types[0] = &ta;
+        c.types[1] = &tb;
+        c.i = 0;
+        harness.run("setType(std::string)", &set_type_string, &c, 100000);
+        harness.run("setType(WeaponType)", &set_type_registered, &c, 100000);
+        std::cerr << "  sizeof(Weapon) " << sizeof(Weapon) << ", "
+                  << WeaponType::registered() << " types registered\n";
+    }
+    {
+        Weapon          shared(weapons[0]);
+        std::string     a("crude spiked club");
+        std::string     b("some other type of club");
+        std::string     locked(a);
+        WeaponType      ta(a);
+        WeaponType      tb(b);
+        pthread_mutex_t lock;
+        MixCase         mix;
+
+        pthread_mutex_init(&lock, NULL);
+        mix.proto.weapon = &shared;
+        mix.proto.types[0] = &ta;
+        mix.proto.types[1] = &tb;
+        mix.proto.locked_type = &locked;
+        mix.proto.names[0] = &a;
+        mix.proto.names[1] = &b;
+        mix.proto.lock = &lock;
+        mix.failed = false;
+        i = 0;
+        while (i < sizeof(thread_counts) / sizeof(*thread_counts))
+        {
+            mix.threads = thread_counts[i];
+            mix.proto.ops = humans / mix.threads;
+            mix.worker = &mix_locked_worker;
+            name.str("");
+            name << "99/1 mutex  " << std::setw(2) << mix.threads
+                 << " threads";
+            harness.run(name.str(), &run_mix, &mix, 1, 0,
+                        mix.proto.ops * mix.threads);
+            mix.worker = &mix_worker;
+            name.str("");
+            name << "99/1 Weapon " << std::setw(2) << mix.threads
+                 << " threads";
+            harness.run(name.str(), &run_mix, &mix, 1, 0,
+                        mix.proto.ops * mix.threads);
+            if (mix.failed)
+                break;
+            i++;
+        }
+        pthread_mutex_destroy(&lock);
+        if (mix.failed)
+        {
+            std::cerr << "Error: cannot start " << mix.threads
+                      << " threads\n";
+            return 1;
+        }
+    }
+    {
+        HumanA bob("Bob", weapons[0]);
+
+        harness.run("HumanA::attack + endl", &human_attack, &bob, 100000);
+    }
+    i = 0;
+    while (i < sizeof(thread_counts) / sizeof(*thread_counts))
+    {
+        Battle      battle(thread_counts[i], 1);
+        TickCase    c;
+
+        t = 0;
+        while (t < humans)
+        {
+            if (t % 10 == 9)
+                battle.add("Jim");
+            else
+                battle.add("Bob", weapons[t % weapons.size()]);
+            t++;
+        }
+        c.battle = &battle;
+        c.output = Battle::TEXT;
+        name.str("");
+        name << "Battle text  " << std::setw(2) << battle.threads()
+             << " threads";
+        harness.run(name.str(), &tick, &c, 1, 0, humans);
+        c.output = Battle::COUNT;
+        name.str("");
+        name << "Battle count " << std::setw(2) << battle.threads()
+             << " threads";
+        harness.run(name.str(), &tick, &c, 1, 0, humans);
+        i++;
+    }
+    return harness.finish();
+}
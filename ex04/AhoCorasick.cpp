@@ -0,0 +1,177 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   AhoCorasick.cpp                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: marvin <marvin@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 01:20:33 by marvin            #+#    #+#             */
+/*   Updated: 2026/10/17 01:20:33 by marvin           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "AhoCorasick.hpp"
+
+AhoCorasick::AhoCorasick()
+    : built(false)
+{
+    addState(-1);
+}
+
+int AhoCorasick::addState(int parent_depth)
+{
+    int id;
+
+    id = static_cast<int>(depth.size());
+    next.resize(next.size() + ALPHABET, -1);
+    fail.push_back(0);
+    depth.push_back(parent_depth + 1);
+    terminal.push_back(-1);
+    output.push_back(-1);
+    return id;
+}
+
+// Adds s1 -> s2. When the same s1 appears twice, the first rule wins.
+bool AhoCorasick::addRule(const std::string& s1, const std::string& s2)
+{
+    std::size_t   i;
+    int           state;
+    int           child;
+    unsigned char c;
+
+    if (s1.empty() || built)
+        return false;
+    state = 0;
+    i = 0;
+    while (i < s1.length())
+    {
+        c = static_cast<unsigned char>(s1[i]);
+        child = next[state * ALPHABET + c];
+        if (child < 0)
+        {
+            child = addState(depth[state]);
+            next[state * ALPHABET + c] = child;
+        }
+        state = child;
+        i++;
+    }
+    if (terminal[state] < 0)
+    {
+        terminal[state] = static_cast<int>(from.size());
+        from.push_back(s1);
+        to.push_back(s2);
+    }
+    return true;
+}
+
+// Turns the trie into a complete DFA: every missing goto edge is replaced by
+// the edge of the failure state, so scanning is one table load per byte.
+// output[s] is the rule of the longest pattern that ends in state s.
+void AhoCorasick::build()
+{
+    std::vector<int> queue;
+    std::size_t      head;
+    int              u;
+    int              v;
+    int              c;
+
+    queue.reserve(depth.size());
+    c = 0;
+    while (c < ALPHABET)
+    {
+        v = next[c];
+        if (v < 0)
+            next[c] = 0;
+        else
+        {
+            fail[v] = 0;
+            output[v] = terminal[v];
+            queue.push_back(v);
+        }
+        c++;
+    }
+    head = 0;
+    while (head < queue.size())
+    {
+        u = queue[head++];
+        c = 0;
+        while (c < ALPHABET)
+        {
+            v = next[u * ALPHABET + c];
+            if (v < 0)
+                next[u * ALPHABET + c] = next[fail[u] * ALPHABET + c];
+            else
+            {
+                fail[v] = next[fail[u] * ALPHABET + c];
+                output[v] = terminal[v] >= 0 ? terminal[v] : output[fail[v]];
+                queue.push_back(v);
+            }
+            c++;
+        }
+    }
+    built = true;
+}
+
+// Leftmost-longest, non-overlapping: among all matches the one starting
+// first wins, ties go to the longest pattern, and scanning resumes right
+// after the replaced text. A candidate is committed once the automaton
+// state proves that no match starting at or before it can still appear.
+void AhoCorasick::replaceAll(const char* text, std::size_t n,
+                             std::string& out) const
+{
+    std::size_t i;
+    std::size_t pos;
+    std::size_t start;
+    std::size_t cand_start;
+    std::size_t cand_len;
+    int         cand;
+    int         state;
+    int         r;
+
+    out.reserve(out.size() + n);
+    pos = 0;
+    i = 0;
+    state = 0;
+    cand = -1;
+    cand_start = 0;
+    cand_len = 0;
+    while (i < n || cand >= 0)
+    {
+        if (i < n)
+        {
+            state = next[state * ALPHABET + static_cast<unsigned char>(text[i])];
+            i++;
+            r = output[state];
+            if (r >= 0)
+            {
+                start = i - from[r].length();
+                if (cand < 0 || start < cand_start
+                    || (start == cand_start && from[r].length() > cand_len))
+                {
+                    cand = r;
+                    cand_start = start;
+                    cand_len = from[r].length();
+                }
+            }
+            if (cand < 0 || i - depth[state] <= cand_start)
+                continue;
+        }
+        out.append(text + pos, cand_start - pos);
+        out += to[cand];
+        pos = cand_start + cand_len;
+        i = pos;
+        state = 0;
+        cand = -1;
+    }
+    out.append(text + pos, n - pos);
+}
+
+std::size_t AhoCorasick::ruleCount() const
+{
+    return from.size();
+}
+
+std::size_t AhoCorasick::stateCount() const
+{
+    return depth.size();
+}
@@ -0,0 +1,47 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   AhoCorasick.hpp                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: marvin <marvin@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 01:20:33 by marvin            #+#    #+#             */
+/*   Updated: 2026/10/17 01:20:33 by marvin           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef AHOCORASICK_HPP
+#define AHOCORASICK_HPP
+
+#include <string>
+#include <vector>
+#include <cstddef>
+
+class AhoCorasick
+{
+    private:
+        std::vector<int>            next;
+        std::vector<int>            fail;
+        std::vector<int>            depth;
+        std::vector<int>            terminal;
+        std::vector<int>            output;
+        std::vector<std::string>    from;
+        std::vector<std::string>    to;
+        bool                        built;
+
+        int addState(int parent_depth);
+
+    public:
+        static const int ALPHABET = 256;
+
+        AhoCorasick();
+
+        bool addRule(const std::string& s1, const std::string& s2);
+        void build();
+        void replaceAll(const char* text, std::size_t n,
+                        std::string& out) const;
+        std::size_t ruleCount() const;
+        std::size_t stateCount() const;
+};
+
+#endif
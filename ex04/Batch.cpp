@@ -0,0 +1,195 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   Batch.cpp                                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: marvin <marvin@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 05:08:26 by marvin            #+#    #+#             */
+/*   Updated: 2026/10/17 08:02:45 by marvin           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "Batch.hpp"
+#include "Sed.hpp"
+#include <iostream>
+#include <sstream>
+#include <iomanip>
+#include <dirent.h>
+#include <pthread.h>
+#include <sys/stat.h>
+#include <time.h>
+
+struct BatchState
+{
+    const BatchJob*     job;
+    std::size_t         next;
+    std::size_t         failed;
+    unsigned long long  bytes;
+    pthread_mutex_t     lock;
+};
+
+static double now_seconds(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static bool ends_with(const std::string& s, const std::string& suffix)
+{
+    return s.length() >= suffix.length()
+        && s.compare(s.length() - suffix.length(), suffix.length(), suffix) == 0;
+}
+
+// Walks directories recursively. Symlinks are not followed and our own
+// .replace outputs are skipped so a second run does not feed on the first.
+bool collect_files(const std::string& path, std::vector<std::string>& files)
+{
+    struct stat     st;
+    DIR*            dir;
+    struct dirent*  ent;
+    std::string     name;
+    bool            ok;
+
+    if (lstat(path.c_str(), &st) != 0)
+        return false;
+    if (S_ISREG(st.st_mode))
+    {
+        if (!ends_with(path, ".replace"))
+            files.push_back(path);
+        return true;
+    }
+    if (!S_ISDIR(st.st_mode))
+        return true;
+    dir = opendir(path.c_str());
+    if (!dir)
+        return false;
+    ok = true;
+    while ((ent = readdir(dir)) != NULL)
+    {
+        name = ent->d_name;
+        if (name == "." || name == "..")
+            continue;
+        if (!collect_files(path + "/" + name, files))
+            ok = false;
+    }
+    closedir(dir);
+    return ok;
+}
+
+// Both buffers live for the whole run of a worker, so after the first few
+// files no more allocations happen unless a bigger file comes along.
+static bool process_file(const BatchJob& job, const std::string& filename,
+                         std::string& in, std::string& out,
+                         std::size_t& bytes)
+{
+    if (!read_text_file(filename, in, job.io))
+        return false;
+    bytes = in.length();
+    if (job.rules)
+    {
+        out.clear();
+        job.rules->replaceAll(in.data(), in.length(), out);
+        return write_text_file(filename, out, job.io);
+    }
+    if (job.s2.length() <= job.s1.length())
+    {
+        replace_in_place(in, job.s1, job.s2);
+        return write_text_file(filename, in, job.io);
+    }
+    build_replaced(in, job.s1, job.s2, out);
+    return write_text_file(filename, out, job.io);
+}
+
+static void* batch_worker(void* raw)
+{
+    BatchState*         st;
+    std::string         in;
+    std::string         out;
+    std::ostringstream  line;
+    std::size_t         index;
+    std::size_t         bytes;
+    double              start;
+    double              elapsed;
+    bool                ok;
+
+    st = static_cast<BatchState*>(raw);
+    while (true)
+    {
+        pthread_mutex_lock(&st->lock);
+        index = st->next++;
+        pthread_mutex_unlock(&st->lock);
+        if (index >= st->job->files.size())
+            break;
+
+        const std::string& filename = st->job->files[index];
+        start = now_seconds();
+        bytes = 0;
+        ok = process_file(*st->job, filename, in, out, bytes);
+        elapsed = now_seconds() - start;
+
+        line.str("");
+        line << filename << ": ";
+        if (ok)
+            line << bytes << " bytes in " << std::fixed
+                 << std::setprecision(3) << elapsed * 1e3 << " ms ("
+                 << std::setprecision(1)
+                 << (elapsed > 0 ? bytes / elapsed / 1e6 : 0.0)
+                 << " MB/s)\n";
+        else
+            line << "failed\n";
+        pthread_mutex_lock(&st->lock);
+        if (ok)
+            st->bytes += bytes;
+        else
+            st->failed++;
+        std::cout << line.str();
+        pthread_mutex_unlock(&st->lock);
+    }
+    return NULL;
+}
+
+std::size_t run_batch(const BatchJob& job)
+{
+    std::vector<pthread_t>  tids;
+    BatchState              st;
+    unsigned int            count;
+    unsigned int            i;
+    pthread_t               tid;
+    double                  start;
+    double                  elapsed;
+
+    st.job = &job;
+    st.next = 0;
+    st.failed = 0;
+    st.bytes = 0;
+    pthread_mutex_init(&st.lock, NULL);
+    count = job.threads > 0 ? job.threads : 1;
+    if (count > job.files.size())
+        count = job.files.size() > 0 ? job.files.size() : 1;
+
+    start = now_seconds();
+    i = 1;
+    while (i < count)
+    {
+        if (pthread_create(&tid, NULL, &batch_worker, &st) == 0)
+            tids.push_back(tid);
+        i++;
+    }
+    batch_worker(&st);
+    i = 0;
+    while (i < tids.size())
+        pthread_join(tids[i++], NULL);
+    elapsed = now_seconds() - start;
+    pthread_mutex_destroy(&st.lock);
+
+    std::cout << "batch: " << job.files.size() << " files, "
+              << st.failed << " failed, " << st.bytes << " bytes in "
+              << std::fixed << std::setprecision(3) << elapsed << " s ("
+              << std::setprecision(1)
+              << (elapsed > 0 ? st.bytes / elapsed / 1e6 : 0.0)
+              << " MB/s, " << tids.size() + 1 << " threads)\n";
+    return st.failed;
+}
@@ -0,0 +1,34 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   Batch.hpp                                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: marvin <marvin@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 05:08:26 by marvin            #+#    #+#             */
+/*   Updated: 2026/10/17 08:02:45 by marvin           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef BATCH_HPP
+#define BATCH_HPP
+
+#include <string>
+#include <vector>
+#include "AhoCorasick.hpp"
+#include "Sed.hpp"
+
+struct BatchJob
+{
+    std::vector<std::string>    files;
+    std::string                 s1;
+    std::string                 s2;
+    const AhoCorasick*          rules;
+    unsigned int                threads;
+    IoOptions                   io;
+};
+
+bool collect_files(const std::string& path, std::vector<std::string>& files);
+std::size_t run_batch(const BatchJob& job);
+
+#endif
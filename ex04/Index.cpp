@@ -0,0 +1,210 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   Index.cpp                                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: marvin <marvin@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 09:26:37 by marvin            #+#    #+#             */
+/*   Updated: 2026/10/18 15:40:12 by marvin           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "Index.hpp"
+#include "Search.hpp"
+#include <fstream>
+#include <cstring>
+
+// File layout: the 8-byte magic, four little-endian u64 header fields
+// (file size, s1 length, FNV-1a hash of s1, match count), then one LEB128
+// varint per match holding the gap since the end of the previous match.
+// Typical gaps fit in one or two bytes instead of eight.
+static const char           INDEX_MAGIC[8] = {'S', 'E', 'D', 'I', 'D', 'X', '1', '\0'};
+static const std::size_t    HEADER_SIZE = 8 + 4 * 8;
+
+static unsigned long long hash_pattern(const std::string& s1)
+{
+    unsigned long long  h;
+    std::size_t         i;
+
+    h = 14695981039346656037ULL;
+    i = 0;
+    while (i < s1.length())
+    {
+        h ^= static_cast<unsigned char>(s1[i++]);
+        h *= 1099511628211ULL;
+    }
+    return h;
+}
+
+static void put_varint(std::string& out, unsigned long long v)
+{
+    while (v >= 0x80)
+    {
+        out += static_cast<char>((v & 0x7f) | 0x80);
+        v >>= 7;
+    }
+    out += static_cast<char>(v);
+}
+
+static bool get_varint(const std::string& in, std::size_t& pos,
+                       unsigned long long& v)
+{
+    unsigned int    shift;
+    unsigned char   byte;
+
+    v = 0;
+    shift = 0;
+    while (pos < in.length() && shift < 64)
+    {
+        byte = static_cast<unsigned char>(in[pos++]);
+        v |= static_cast<unsigned long long>(byte & 0x7f) << shift;
+        if (!(byte & 0x80))
+            return true;
+        shift += 7;
+    }
+    return false;
+}
+
+static void put_u64(std::string& out, unsigned long long v)
+{
+    int i;
+
+    i = 0;
+    while (i < 8)
+    {
+        out += static_cast<char>((v >> (8 * i)) & 0xff);
+        i++;
+    }
+}
+
+static unsigned long long get_u64(const char* p)
+{
+    unsigned long long  v;
+    int                 i;
+
+    v = 0;
+    i = 7;
+    while (i >= 0)
+    {
+        v = (v << 8) | static_cast<unsigned char>(p[i]);
+        i--;
+    }
+    return v;
+}
+
+// Same greedy, non-overlapping scan as build_replaced, but it only records
+// where the matches are.
+std::size_t build_match_index(const char* text, std::size_t n,
+                              const std::string& s1, MatchIndex& index)
+{
+    const char* pos;
+    const char* hit;
+    const char* end;
+
+    index.file_size = n;
+    index.pattern_len = s1.length();
+    index.pattern_hash = hash_pattern(s1);
+    index.count = 0;
+    index.gaps.clear();
+    pos = text;
+    end = text + n;
+    hit = find_bytes(pos, end - pos, s1);
+    while (hit)
+    {
+        put_varint(index.gaps, hit - pos);
+        index.count++;
+        pos = hit + s1.length();
+        hit = find_bytes(pos, end - pos, s1);
+    }
+    return index.count;
+}
+
+bool write_match_index(const std::string& filename, const MatchIndex& index)
+{
+    std::ofstream   out(filename.c_str(), std::ios::out | std::ios::binary);
+    std::string     header;
+
+    if (!out.is_open())
+        return false;
+    header.append(INDEX_MAGIC, sizeof(INDEX_MAGIC));
+    put_u64(header, index.file_size);
+    put_u64(header, index.pattern_len);
+    put_u64(header, index.pattern_hash);
+    put_u64(header, index.count);
+    out.write(header.data(), header.length());
+    out.write(index.gaps.data(), index.gaps.length());
+    return out.good();
+}
+
+bool read_match_index(const std::string& filename, MatchIndex& index)
+{
+    std::ifstream   in(filename.c_str(), std::ios::in | std::ios::binary);
+    char            header[HEADER_SIZE];
+    char            buf[64 * 1024];
+
+    if (!in.is_open())
+        return false;
+    in.read(header, HEADER_SIZE);
+    if (in.gcount() != static_cast<std::streamsize>(HEADER_SIZE)
+        || std::memcmp(header, INDEX_MAGIC, sizeof(INDEX_MAGIC)) != 0)
+        return false;
+    index.file_size = get_u64(header + 8);
+    index.pattern_len = get_u64(header + 16);
+    index.pattern_hash = get_u64(header + 24);
+    index.count = get_u64(header + 32);
+    index.gaps.clear();
+    while (in.read(buf, sizeof(buf)) || in.gcount() > 0)
+        index.gaps.append(buf, in.gcount());
+    return !in.bad();
+}
+
+// Rebuilds the output from the stored offsets without searching. The index
+// is rejected when it was made for another file size or another s1, and
+// every offset is still checked with one memcmp() so a file edited in place
+// cannot silently produce garbage.
+bool apply_match_index(const char* text, std::size_t n,
+                       const MatchIndex& index,
+                       const std::string& s1, const std::string& s2,
+                       std::string& out)
+{
+    unsigned long long  gap;
+    unsigned long long  k;
+    std::size_t         pos;
+    std::size_t         cursor;
+    std::size_t         hit;
+    char*               dst;
+
+    if (index.file_size != n || index.pattern_len != s1.length()
+        || index.pattern_hash != hash_pattern(s1)
+        || index.count > n / s1.length())
+        return false;
+    out.resize(n - index.count * s1.length() + index.count * s2.length());
+    // dst stays NULL for an empty output, so empty copies are skipped.
+    dst = out.empty() ? NULL : &out[0];
+    pos = 0;
+    cursor = 0;
+    k = 0;
+    while (k < index.count)
+    {
+        if (!get_varint(index.gaps, cursor, gap) || gap > n - pos
+            || n - pos - gap < s1.length())
+            return false;
+        hit = pos + gap;
+        if (std::memcmp(text + hit, s1.data(), s1.length()) != 0)
+            return false;
+        if (gap)
+            std::memcpy(dst, text + pos, gap);
+        dst += gap;
+        if (!s2.empty())
+            std::memcpy(dst, s2.data(), s2.length());
+        dst += s2.length();
+        pos = hit + s1.length();
+        k++;
+    }
+    if (cursor != index.gaps.length())
+        return false;
+    if (n > pos)
+        std::memcpy(dst, text + pos, n - pos);
+    return true;
+}
@@ -0,0 +1,37 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   Index.hpp                                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: marvin <marvin@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 09:26:37 by marvin            #+#    #+#             */
+/*   Updated: 2026/10/17 09:26:37 by marvin           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef INDEX_HPP
+#define INDEX_HPP
+
+#include <string>
+#include <cstddef>
+
+struct MatchIndex
+{
+    unsigned long long  file_size;
+    unsigned long long  pattern_len;
+    unsigned long long  pattern_hash;
+    unsigned long long  count;
+    std::string         gaps;
+};
+
+std::size_t build_match_index(const char* text, std::size_t n,
+                              const std::string& s1, MatchIndex& index);
+bool write_match_index(const std::string& filename, const MatchIndex& index);
+bool read_match_index(const std::string& filename, MatchIndex& index);
+bool apply_match_index(const char* text, std::size_t n,
+                       const MatchIndex& index,
+                       const std::string& s1, const std::string& s2,
+                       std::string& out);
+
+#endif
@@ -0,0 +1,249 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   Parallel.cpp                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: marvin <marvin@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 02:47:10 by marvin            #+#    #+#             */
+/*   Updated: 2026/10/18 11:52:20 by marvin           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "Sed.hpp"
+#include <algorithm>
+#include <cstring>
+#include <cstdlib>
+#include <vector>
+#include <pthread.h>
+
+// Shards smaller than this are not worth a thread.
+static const std::size_t MIN_SHARD = 256 * 1024;
+
+struct Shard
+{
+    std::size_t                 begin;
+    std::size_t                 end;
+    std::size_t                 src_begin;
+    std::size_t                 out_offset;
+    std::vector<std::size_t>    hits;
+};
+
+struct ParallelJob
+{
+    const char*             text;
+    std::size_t             n;
+    const std::string*      s1;
+    const std::string*      s2;
+    std::vector<Shard>*     shards;
+    char*                   out;
+};
+
+struct WorkerArg
+{
+    ParallelJob*    job;
+    std::size_t     index;
+    bool            copy_phase;
+};
+
+// Greedy non-overlapping scan starting at `from`. Every match found starts
+// inside [from, sh.end) because the window stops s1.length() - 1 bytes past
+// the shard end.
+static void scan_shard(const ParallelJob& job, Shard& sh, std::size_t from)
+{
+    std::size_t m;
+    std::size_t limit;
+    const char* hit;
+
+    m = job.s1->length();
+    limit = std::min(job.n, sh.end + m - 1);
+    while (from < sh.end)
+    {
+        hit = find_bytes(job.text + from, limit - from, *job.s1);
+        if (!hit)
+            break;
+        sh.hits.push_back(hit - job.text);
+        from = sh.hits.back() + m;
+    }
+}
+
+static void copy_shard(const ParallelJob& job, const Shard& sh)
+{
+    std::size_t cur;
+    std::size_t i;
+    char*       dst;
+
+    dst = job.out + sh.out_offset;
+    cur = sh.src_begin;
+    i = 0;
+    while (i < sh.hits.size())
+    {
+        std::memcpy(dst, job.text + cur, sh.hits[i] - cur);
+        dst += sh.hits[i] - cur;
+        std::memcpy(dst, job.s2->data(), job.s2->length());
+        dst += job.s2->length();
+        cur = sh.hits[i] + job.s1->length();
+        i++;
+    }
+    if (cur < sh.end)
+        std::memcpy(dst, job.text + cur, sh.end - cur);
+}
+
+static void* shard_worker(void* raw)
+{
+    WorkerArg*  arg;
+    Shard*      sh;
+
+    arg = static_cast<WorkerArg*>(raw);
+    sh = &(*arg->job->shards)[arg->index];
+    if (arg->copy_phase)
+        copy_shard(*arg->job, *sh);
+    else
+        scan_shard(*arg->job, *sh, sh->begin);
+    return NULL;
+}
+
+static void run_phase(ParallelJob& job, bool copy_phase)
+{
+    std::vector<pthread_t>  tids(job.shards->size());
+    std::vector<WorkerArg>  args(job.shards->size());
+    std::vector<bool>       started(job.shards->size(), false);
+    std::size_t             i;
+
+    i = 0;
+    while (i < args.size())
+    {
+        args[i].job = &job;
+        args[i].index = i;
+        args[i].copy_phase = copy_phase;
+        if (i > 0)
+            started[i] = pthread_create(&tids[i], NULL,
+                                        &shard_worker, &args[i]) == 0;
+        i++;
+    }
+    shard_worker(&args[0]);
+    i = 1;
+    while (i < args.size())
+    {
+        if (started[i])
+            pthread_join(tids[i], NULL);
+        else
+            shard_worker(&args[i]);
+        i++;
+    }
+}
+
+// A shard scanned from its own begin may disagree with the serial result
+// when the previous shard's last match runs past that begin. Rescan from
+// where the serial scan would really resume until we land on a hit the
+// shard already found: from there on both greedy chains are identical.
+// In periodic input ("aaaa..." with s1 "aa") the two chains can stay out
+// of phase for the whole shard, which is then rescanned serially; such
+// input does not scale with threads.
+static void resync_shard(const ParallelJob& job, Shard& sh, std::size_t from)
+{
+    std::vector<std::size_t>            fixed;
+    std::vector<std::size_t>::iterator  it;
+    std::size_t                         m;
+    std::size_t                         limit;
+    const char*                         hit;
+
+    m = job.s1->length();
+    limit = std::min(job.n, sh.end + m - 1);
+    while (from < sh.end)
+    {
+        hit = find_bytes(job.text + from, limit - from, *job.s1);
+        if (!hit)
+            break;
+        it = std::lower_bound(sh.hits.begin(), sh.hits.end(),
+                              static_cast<std::size_t>(hit - job.text));
+        if (it != sh.hits.end() && *it == static_cast<std::size_t>(hit - job.text))
+        {
+            fixed.insert(fixed.end(), it, sh.hits.end());
+            break;
+        }
+        fixed.push_back(hit - job.text);
+        from = fixed.back() + m;
+    }
+    sh.hits.swap(fixed);
+}
+
+static std::size_t shard_output_size(const Shard& sh, std::size_t m1,
+                                     std::size_t m2)
+{
+    std::size_t last;
+    std::size_t size;
+
+    last = sh.hits.empty() ? sh.src_begin : sh.hits.back() + m1;
+    size = last - sh.src_begin - sh.hits.size() * m1 + sh.hits.size() * m2;
+    if (last < sh.end)
+        size += sh.end - last;
+    return size;
+}
+
+bool parallel_replace(const char* text, std::size_t n,
+                      const std::string& s1, const std::string& s2,
+                      unsigned int threads, OutputBuffer& out)
+{
+    std::vector<Shard>  shards;
+    ParallelJob         job;
+    std::size_t         count;
+    std::size_t         carry;
+    std::size_t         total;
+    std::size_t         k;
+
+    out.data = NULL;
+    out.size = 0;
+    if (s1.empty())
+        return false;
+    count = threads > 0 ? threads : 1;
+    if (n / MIN_SHARD < count)
+        count = n / MIN_SHARD > 0 ? n / MIN_SHARD : 1;
+    shards.resize(count);
+    k = 0;
+    while (k < count)
+    {
+        shards[k].begin = n / count * k;
+        shards[k].end = (k + 1 == count) ? n : n / count * (k + 1);
+        k++;
+    }
+    job.text = text;
+    job.n = n;
+    job.s1 = &s1;
+    job.s2 = &s2;
+    job.shards = &shards;
+    job.out = NULL;
+    run_phase(job, false);
+
+    carry = 0;
+    total = 0;
+    k = 0;
+    while (k < count)
+    {
+        Shard& sh = shards[k];
+        sh.src_begin = std::max(sh.begin, carry);
+        if (sh.src_begin > sh.begin)
+            resync_shard(job, sh, sh.src_begin);
+        if (!sh.hits.empty())
+            carry = sh.hits.back() + s1.length();
+        sh.out_offset = total;
+        total += shard_output_size(sh, s1.length(), s2.length());
+        k++;
+    }
+    if (total == 0)
+        return true;
+    out.data = static_cast<char*>(std::malloc(total));
+    if (!out.data)
+        return false;
+    out.size = total;
+    job.out = out.data;
+    run_phase(job, true);
+    return true;
+}
+
+void free_output(OutputBuffer& out)
+{
+    std::free(out.data);
+    out.data = NULL;
+    out.size = 0;
+}
@@ -0,0 +1,158 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   Search.cpp                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: marvin <marvin@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 00:02:51 by marvin            #+#    #+#             */
+/*   Updated: 2026/10/18 10:05:12 by marvin           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "Search.hpp"
+#include <cstring>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+# define SEARCH_X86 1
+# include <immintrin.h>
+#endif
+
+typedef const char* (*search_fn)(const char*, std::size_t,
+                                 const char*, std::size_t);
+
+static const char* find_scalar(const char* hay, std::size_t n,
+                               const char* nd, std::size_t m)
+{
+    const char* end;
+    const char* p;
+
+    end = hay + n - m + 1;
+    p = hay;
+    while (p < end)
+    {
+        p = static_cast<const char*>(std::memchr(p, nd[0], end - p));
+        if (!p)
+            return NULL;
+        if (p[m - 1] == nd[m - 1] && std::memcmp(p + 1, nd + 1, m - 1) == 0)
+            return p;
+        p++;
+    }
+    return NULL;
+}
+
+#ifdef SEARCH_X86
+
+// Both kernels compare the first and the last byte of the needle against a
+// whole block of candidate positions at once, and only run memcmp() on the
+// positions where both agree. A common first byte alone no longer triggers
+// a full compare at every occurrence.
+
+__attribute__((target("sse2")))
+static const char* find_sse2(const char* hay, std::size_t n,
+                             const char* nd, std::size_t m)
+{
+    const __m128i first = _mm_set1_epi8(nd[0]);
+    const __m128i last = _mm_set1_epi8(nd[m - 1]);
+    std::size_t   i;
+    unsigned int  mask;
+    unsigned int  bit;
+
+    i = 0;
+    while (i + m - 1 + 16 <= n)
+    {
+        const __m128i bf = _mm_loadu_si128(
+            reinterpret_cast<const __m128i*>(hay + i));
+        const __m128i bl = _mm_loadu_si128(
+            reinterpret_cast<const __m128i*>(hay + i + m - 1));
+        mask = _mm_movemask_epi8(_mm_and_si128(_mm_cmpeq_epi8(first, bf),
+                                               _mm_cmpeq_epi8(last, bl)));
+        while (mask)
+        {
+            bit = __builtin_ctz(mask);
+            if (std::memcmp(hay + i + bit + 1, nd + 1, m - 2) == 0)
+                return hay + i + bit;
+            mask &= mask - 1;
+        }
+        i += 16;
+    }
+    if (i + m > n)
+        return NULL;
+    return find_scalar(hay + i, n - i, nd, m);
+}
+
+__attribute__((target("avx2")))
+static const char* find_avx2(const char* hay, std::size_t n,
+                             const char* nd, std::size_t m)
+{
+    const __m256i first = _mm256_set1_epi8(nd[0]);
+    const __m256i last = _mm256_set1_epi8(nd[m - 1]);
+    std::size_t   i;
+    unsigned int  mask;
+    unsigned int  bit;
+
+    i = 0;
+    while (i + m - 1 + 32 <= n)
+    {
+        const __m256i bf = _mm256_loadu_si256(
+            reinterpret_cast<const __m256i*>(hay + i));
+        const __m256i bl = _mm256_loadu_si256(
+            reinterpret_cast<const __m256i*>(hay + i + m - 1));
+        mask = _mm256_movemask_epi8(
+            _mm256_and_si256(_mm256_cmpeq_epi8(first, bf),
+                             _mm256_cmpeq_epi8(last, bl)));
+        while (mask)
+        {
+            bit = __builtin_ctz(mask);
+            if (std::memcmp(hay + i + bit + 1, nd + 1, m - 2) == 0)
+                return hay + i + bit;
+            mask &= mask - 1;
+        }
+        i += 32;
+    }
+    if (i + m > n)
+        return NULL;
+    return find_sse2(hay + i, n - i, nd, m);
+}
+
+#endif
+
+static search_fn pick_kernel(const char** name)
+{
+#ifdef SEARCH_X86
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2"))
+    {
+        *name = "avx2";
+        return &find_avx2;
+    }
+    if (__builtin_cpu_supports("sse2"))
+    {
+        *name = "sse2";
+        return &find_sse2;
+    }
+#endif
+    *name = "scalar";
+    return &find_scalar;
+}
+
+static const char* g_kernel_name = "scalar";
+static const search_fn g_kernel = pick_kernel(&g_kernel_name);
+
+const char* find_bytes(const char* hay, std::size_t n,
+                       const std::string& needle)
+{
+    std::size_t m;
+
+    m = needle.length();
+    if (m == 0 || m > n)
+        return NULL;
+    if (m == 1)
+        return static_cast<const char*>(std::memchr(hay, needle[0], n));
+    return g_kernel(hay, n, needle.data(), m);
+}
+
+const char* search_kernel_name(void)
+{
+    return g_kernel_name;
+}
@@ -0,0 +1,23 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   Search.hpp                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: marvin <marvin@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 00:02:51 by marvin            #+#    #+#             */
+/*   Updated: 2026/10/17 00:02:51 by marvin           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef SEARCH_HPP
+#define SEARCH_HPP
+
+#include <string>
+#include <cstddef>
+
+const char* find_bytes(const char* hay, std::size_t n,
+                       const std::string& needle);
+const char* search_kernel_name(void);
+
+#endif
@@ -6,30 +6,222 @@
 /*   By: marvin <marvin@student.42.fr>              +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2026/01/11 16:38:33 by marvin            #+#    #+#             */
-/*   Updated: 2026/01/11 16:38:33 by marvin           ###   ########.fr       */
+/*   Updated: 2026/10/18 11:52:20 by marvin           ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
 #include "Sed.hpp"
 #include <fstream>
+#include <algorithm>
+#include <cstring>
+#include <cstdlib>
+#include <cerrno>
+#include <climits>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/uio.h>
+#include <unistd.h>
 
-bool read_text_file(const std::string& filename, std::string& out)
+#ifndef IOV_MAX
+# define IOV_MAX 1024
+#endif
+
+// Bytes read per step by stream_replace. The working buffer never holds
+// more than this plus s1.length() - 1 carried-over bytes.
+static const std::size_t CHUNK_SIZE = 64 * 1024;
+
+static const std::size_t DIRECT_ALIGN = 4096;
+
+static std::size_t find_from(const std::string& text, std::size_t pos,
+                             const std::string& s1)
 {
-    std::ifstream in(filename.c_str());
-    std::string line;
-    std::string text;
+    const char* hit;
 
-    if (!in.is_open())
+    hit = find_bytes(text.data() + pos, text.length() - pos, s1);
+    if (!hit)
+        return std::string::npos;
+    return hit - text.data();
+}
+
+IoOptions::IoOptions()
+    : buffer_size(1024 * 1024), direct(false), sequential(true)
+{
+}
+
+static int open_input(const std::string& filename, const IoOptions& io)
+{
+    int fd;
+
+    fd = -1;
+#ifdef O_DIRECT
+    if (io.direct)
+        fd = open(filename.c_str(), O_RDONLY | O_DIRECT);
+#endif
+    if (fd < 0)
+        fd = open(filename.c_str(), O_RDONLY);
+    if (fd >= 0 && io.sequential)
+        posix_fadvise(fd, 0, 0, POSIX_FADV_SEQUENTIAL);
+    return fd;
+}
+
+static ssize_t read_some(int fd, char* dst, std::size_t len)
+{
+    ssize_t got;
+
+    got = read(fd, dst, len);
+    while (got < 0 && errno == EINTR)
+        got = read(fd, dst, len);
+    return got;
+}
+
+// O_DIRECT needs the buffer, the length and the file offset aligned to the
+// block size, so reads go through an aligned bounce buffer. Returns false
+// with errno == EINVAL when the filesystem refuses direct I/O.
+static bool read_direct(int fd, std::string& out, std::size_t& used,
+                        const IoOptions& io)
+{
+    std::size_t chunk;
+    void*       bounce;
+    ssize_t     got;
+
+    chunk = (io.buffer_size + DIRECT_ALIGN - 1) / DIRECT_ALIGN * DIRECT_ALIGN;
+    if (posix_memalign(&bounce, DIRECT_ALIGN, chunk) != 0)
         return false;
-    text = "";
-    while (std::getline(in, line))
+    while ((got = read_some(fd, static_cast<char*>(bounce), chunk)) > 0)
     {
-        text += line;
-        if (!in.eof())
-            text += "\n";
+        out.replace(used, std::string::npos,
+                    static_cast<char*>(bounce), got);
+        used += got;
     }
-    out = text;
-    return true;
+    std::free(bounce);
+    return got == 0;
+}
+
+// Reads the file as raw bytes: CR, NUL and a missing final newline all
+// survive. out keeps its capacity, so one buffer can serve many files.
+// A regular file is read into a buffer of exactly st_size bytes, and EOF
+// is confirmed with a small probe read so the buffer is never regrown
+// just to see the end. Other files grow geometrically.
+bool read_text_file(const std::string& filename, std::string& out,
+                    const IoOptions& io)
+{
+    struct stat st;
+    char        probe[4096];
+    std::size_t used;
+    ssize_t     got;
+    int         fd;
+    bool        ok;
+    bool        regular;
+
+    fd = open_input(filename, io);
+    if (fd < 0)
+        return false;
+    used = 0;
+    out.clear();
+    regular = (fstat(fd, &st) == 0 && S_ISREG(st.st_mode));
+    if (regular)
+        out.reserve(st.st_size);
+    if (io.direct && read_direct(fd, out, used, io))
+    {
+        close(fd);
+        return true;
+    }
+    if (io.direct)
+    {
+        close(fd);
+        if (errno != EINVAL || used > 0)
+            return false;
+        fd = open(filename.c_str(), O_RDONLY);
+        if (fd < 0)
+            return false;
+    }
+    if (regular)
+        out.resize(st.st_size);
+    ok = true;
+    while (true)
+    {
+        if (used == out.length())
+        {
+            got = read_some(fd, probe, sizeof(probe));
+            if (got <= 0)
+            {
+                ok = (got == 0);
+                break;
+            }
+            out.resize(std::max(used * 2, used + io.buffer_size));
+            std::memcpy(&out[used], probe, got);
+            used += got;
+            continue;
+        }
+        got = read_some(fd, &out[used],
+                        std::min(out.length() - used, io.buffer_size));
+        if (got <= 0)
+        {
+            ok = (got == 0);
+            break;
+        }
+        used += got;
+    }
+    out.resize(used);
+    close(fd);
+    return ok;
+}
+
+std::size_t count_matches(const char* text, std::size_t n,
+                          const std::string& s1)
+{
+    std::size_t hits;
+    const char* end;
+    const char* hit;
+
+    hits = 0;
+    end = text + n;
+    hit = find_bytes(text, n, s1);
+    while (hit)
+    {
+        hits++;
+        text = hit + s1.length();
+        hit = find_bytes(text, end - text, s1);
+    }
+    return hits;
+}
+
+// Two passes: count the matches first so the result can be sized exactly,
+// then fill it with memcpy() without any temporary strings. out keeps its
+// capacity between calls, so callers can reuse one buffer for many files.
+void build_replaced(const std::string& text,
+                    const std::string& s1,
+                    const std::string& s2,
+                    std::string& out)
+{
+    std::size_t hits;
+    std::size_t pos;
+    std::size_t hit;
+    char*       dst;
+
+    hits = count_matches(text.data(), text.length(), s1);
+    if (hits == 0)
+    {
+        out.assign(text);
+        return;
+    }
+    out.resize(text.length() - hits * s1.length() + hits * s2.length());
+    if (out.empty())
+        return;
+    dst = &out[0];
+    pos = 0;
+    hit = find_from(text, pos, s1);
+    while (hit != std::string::npos)
+    {
+        std::memcpy(dst, text.data() + pos, hit - pos);
+        dst += hit - pos;
+        std::memcpy(dst, s2.data(), s2.length());
+        dst += s2.length();
+        pos = hit + s1.length();
+        hit = find_from(text, pos, s1);
+    }
+    std::memcpy(dst, text.data() + pos, text.length() - pos);
 }
 
 std::string build_replaced(const std::string& text,
@@ -37,29 +229,253 @@ std::string build_replaced(const std::string& text,
                            const std::string& s2)
 {
     std::string out;
+
+    build_replaced(text, s1, s2, out);
+    return out;
+}
+
+// Rewrites text without a second buffer. Only valid when s2 is not longer
+// than s1, so the write position never overtakes the unread input.
+std::size_t replace_in_place(std::string& text,
+                             const std::string& s1,
+                             const std::string& s2)
+{
+    std::size_t hits;
     std::size_t pos;
     std::size_t hit;
+    std::size_t dst;
+    char*       base;
 
-    out = "";
+    if (s2.length() > s1.length() || text.empty())
+        return 0;
+    base = &text[0];
+    hits = 0;
     pos = 0;
-    hit = text.find(s1, pos);
+    dst = 0;
+    hit = find_from(text, pos, s1);
     while (hit != std::string::npos)
     {
-        out += text.substr(pos, hit - pos);
-        out += s2;
+        if (dst != pos)
+            std::memmove(base + dst, base + pos, hit - pos);
+        dst += hit - pos;
+        std::memcpy(base + dst, s2.data(), s2.length());
+        dst += s2.length();
         pos = hit + s1.length();
-        hit = text.find(s1, pos);
+        hits++;
+        hit = find_from(text, pos, s1);
     }
-    out += text.substr(pos);
+    if (hits == 0)
+        return 0;
+    std::memmove(base + dst, base + pos, text.length() - pos);
+    text.resize(dst + text.length() - pos);
+    return hits;
+}
+
+std::string build_replaced(const std::string& text,
+                           const AhoCorasick& rules)
+{
+    std::string out;
+
+    rules.replaceAll(text.data(), text.length(), out);
     return out;
 }
 
-bool write_text_file(const std::string& filename, const std::string& text)
+// One rule per line: s1, a tab, then s2 (which may be empty). Blank lines
+// are skipped and a trailing '\r' is dropped so CRLF rule files work.
+bool read_rules_file(const std::string& filename, AhoCorasick& rules)
+{
+    std::ifstream     in(filename.c_str());
+    std::string       line;
+    std::size_t       tab;
+
+    if (!in.is_open())
+        return false;
+    while (std::getline(in, line))
+    {
+        if (!line.empty() && line[line.length() - 1] == '\r')
+            line.erase(line.length() - 1);
+        if (line.empty())
+            continue;
+        tab = line.find('\t');
+        if (tab == std::string::npos || tab == 0)
+            return false;
+        rules.addRule(line.substr(0, tab), line.substr(tab + 1));
+    }
+    if (in.bad() || rules.ruleCount() == 0)
+        return false;
+    rules.build();
+    return true;
+}
+
+bool write_text_file(const std::string& filename, const std::string& text,
+                     const IoOptions& io)
+{
+    return write_text_file(filename, text.data(), text.length(), io);
+}
+
+bool write_text_file(const std::string& filename, const char* data,
+                     std::size_t len, const IoOptions& io)
+{
+    std::size_t done;
+    ssize_t     put;
+    int         fd;
+
+    fd = open((filename + ".replace").c_str(),
+              O_WRONLY | O_CREAT | O_TRUNC, 0666);
+    if (fd < 0)
+        return false;
+    done = 0;
+    while (done < len)
+    {
+        put = write(fd, data + done, std::min(len - done, io.buffer_size));
+        if (put < 0 && errno == EINTR)
+            continue;
+        if (put <= 0)
+        {
+            close(fd);
+            return false;
+        }
+        done += put;
+    }
+    return close(fd) == 0;
+}
+
+bool stream_replace(std::istream& in, std::ostream& out,
+                    const std::string& s1,
+                    const std::string& s2)
+{
+    std::string buf;
+    std::size_t keep;
+    std::size_t old;
+    std::size_t pos;
+    std::size_t hit;
+    std::size_t safe;
+
+    keep = s1.length() - 1;
+    while (in.good())
+    {
+        old = buf.length();
+        buf.resize(old + CHUNK_SIZE);
+        in.read(&buf[old], CHUNK_SIZE);
+        buf.resize(old + in.gcount());
+
+        pos = 0;
+        hit = find_from(buf, pos, s1);
+        while (hit != std::string::npos)
+        {
+            out.write(buf.data() + pos, hit - pos);
+            out << s2;
+            pos = hit + s1.length();
+            hit = find_from(buf, pos, s1);
+        }
+        // The last s1.length() - 1 bytes may be the start of a match that
+        // ends in the next chunk: hold them back instead of writing them.
+        safe = buf.length() > keep ? buf.length() - keep : 0;
+        if (in.good() && safe > pos)
+        {
+            out.write(buf.data() + pos, safe - pos);
+            pos = safe;
+        }
+        buf.erase(0, pos);
+    }
+    out.write(buf.data(), buf.length());
+    return !in.bad() && out.good();
+}
+
+bool map_file(int fd, MappedFile& map)
 {
-    std::ofstream out((filename + ".replace").c_str());
+    struct stat st;
+    void*       addr;
 
-    if (!out.is_open())
+    map.data = NULL;
+    map.size = 0;
+    if (fstat(fd, &st) != 0 || !S_ISREG(st.st_mode) || st.st_size <= 0)
         return false;
-    out << text;
+    addr = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (addr == MAP_FAILED)
+        return false;
+    madvise(addr, st.st_size, MADV_SEQUENTIAL);
+    map.data = static_cast<const char*>(addr);
+    map.size = st.st_size;
+    return true;
+}
+
+void unmap_file(MappedFile& map)
+{
+    if (map.data)
+        munmap(const_cast<char*>(map.data), map.size);
+    map.data = NULL;
+    map.size = 0;
+}
+
+static bool flush_iov(int fd, struct iovec* iov, int count)
+{
+    ssize_t done;
+
+    while (count > 0)
+    {
+        done = writev(fd, iov, count);
+        if (done < 0)
+        {
+            if (errno == EINTR)
+                continue;
+            return false;
+        }
+        while (count > 0 && static_cast<std::size_t>(done) >= iov->iov_len)
+        {
+            done -= iov->iov_len;
+            iov++;
+            count--;
+        }
+        if (count > 0)
+        {
+            iov->iov_base = static_cast<char*>(iov->iov_base) + done;
+            iov->iov_len -= done;
+        }
+    }
     return true;
 }
+
+static bool push_iov(int fd, struct iovec* iov, int& count,
+                     const char* data, std::size_t len)
+{
+    if (len == 0)
+        return true;
+    if (count == IOV_MAX)
+    {
+        if (!flush_iov(fd, iov, count))
+            return false;
+        count = 0;
+    }
+    iov[count].iov_base = const_cast<char*>(data);
+    iov[count].iov_len = len;
+    count++;
+    return true;
+}
+
+bool writev_replace(const MappedFile& map, int out_fd,
+                    const std::string& s1,
+                    const std::string& s2)
+{
+    struct iovec iov[IOV_MAX];
+    int          count;
+    const char*  pos;
+    const char*  end;
+    const char*  hit;
+
+    count = 0;
+    pos = map.data;
+    end = map.data + map.size;
+    hit = find_bytes(pos, end - pos, s1);
+    while (hit)
+    {
+        if (!push_iov(out_fd, iov, count, pos, hit - pos)
+            || !push_iov(out_fd, iov, count, s2.data(), s2.length()))
+            return false;
+        pos = hit + s1.length();
+        hit = find_bytes(pos, end - pos, s1);
+    }
+    if (!push_iov(out_fd, iov, count, pos, end - pos))
+        return false;
+    return flush_iov(out_fd, iov, count);
+}
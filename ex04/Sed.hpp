@@ -6,7 +6,7 @@
 /*   By: marvin <marvin@student.42.fr>              +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2026/01/11 16:38:36 by marvin            #+#    #+#             */
-/*   Updated: 2026/01/11 16:38:36 by marvin           ###   ########.fr       */
+/*   Updated: 2026/10/18 11:52:20 by marvin           ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -14,11 +14,68 @@
 #define SED_HPP
 
 #include <string>
+#include <istream>
+#include <ostream>
+#include <cstddef>
+#include "Search.hpp"
+#include "AhoCorasick.hpp"
 
-bool read_text_file(const std::string& filename, std::string& out);
+struct MappedFile
+{
+    const char*  data;
+    std::size_t  size;
+};
+
+// Output built by parallel_replace. It comes from malloc() so it is not
+// zero-filled first; release it with free_output().
+struct OutputBuffer
+{
+    char*        data;
+    std::size_t  size;
+};
+
+struct IoOptions
+{
+    std::size_t buffer_size;
+    bool        direct;
+    bool        sequential;
+
+    IoOptions();
+};
+
+bool read_text_file(const std::string& filename, std::string& out,
+                    const IoOptions& io = IoOptions());
 std::string build_replaced(const std::string& text,
                            const std::string& s1,
                            const std::string& s2);
-bool write_text_file(const std::string& filename, const std::string& text);
+void build_replaced(const std::string& text,
+                    const std::string& s1,
+                    const std::string& s2,
+                    std::string& out);
+std::size_t count_matches(const char* text, std::size_t n,
+                          const std::string& s1);
+std::size_t replace_in_place(std::string& text,
+                             const std::string& s1,
+                             const std::string& s2);
+std::string build_replaced(const std::string& text,
+                           const AhoCorasick& rules);
+bool read_rules_file(const std::string& filename, AhoCorasick& rules);
+bool write_text_file(const std::string& filename, const std::string& text,
+                     const IoOptions& io = IoOptions());
+bool write_text_file(const std::string& filename, const char* data,
+                     std::size_t len, const IoOptions& io = IoOptions());
+bool stream_replace(std::istream& in, std::ostream& out,
+                    const std::string& s1,
+                    const std::string& s2);
+
+bool map_file(int fd, MappedFile& map);
+void unmap_file(MappedFile& map);
+bool writev_replace(const MappedFile& map, int out_fd,
+                    const std::string& s1,
+                    const std::string& s2);
+bool parallel_replace(const char* text, std::size_t n,
+                      const std::string& s1, const std::string& s2,
+                      unsigned int threads, OutputBuffer& out);
+void free_output(OutputBuffer& out);
 
 #endif
@@ -0,0 +1,116 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   Corpus.cpp                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: marvin <marvin@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 06:40:13 by marvin            #+#    #+#             */
+/*   Updated: 2026/10/17 06:40:13 by marvin           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "Corpus.hpp"
+#include <cstdlib>
+#include <cstring>
+
+void default_corpus_spec(CorpusSpec& spec)
+{
+    spec.size = 64 * 1024 * 1024;
+    spec.density = 1.0;
+    spec.pattern_len = 5;
+    spec.line_len = 80;
+    spec.seed = 42;
+}
+
+// Consumes one "--name value" pair at av[i] if it is a corpus option.
+bool parse_corpus_option(int ac, char **av, int& i, CorpusSpec& spec)
+{
+    std::string opt;
+
+    if (i + 1 >= ac)
+        return false;
+    opt = av[i];
+    if (opt == "--size")
+        spec.size = std::strtoul(av[i + 1], NULL, 10);
+    else if (opt == "--density")
+        spec.density = std::atof(av[i + 1]);
+    else if (opt == "--pattern-len")
+        spec.pattern_len = std::strtoul(av[i + 1], NULL, 10);
+    else if (opt == "--line-len")
+        spec.line_len = std::strtoul(av[i + 1], NULL, 10);
+    else if (opt == "--seed")
+        spec.seed = std::strtoul(av[i + 1], NULL, 10);
+    else
+        return false;
+    if (spec.pattern_len == 0)
+        spec.pattern_len = 1;
+    if (spec.line_len == 0)
+        spec.line_len = 1;
+    i += 2;
+    return true;
+}
+
+const char* corpus_usage(void)
+{
+    return "  --size <bytes>         corpus size (default 64 MiB)\n"
+           "  --density <n>          matches per KiB (default 1.0)\n"
+           "  --pattern-len <n>      length of s1 (default 5)\n"
+           "  --line-len <n>         bytes per line (default 80)\n"
+           "  --seed <n>             generator seed (default 42)\n";
+}
+
+// Upper-case so the lower-case filler can never match by accident. The
+// first letter repeats the "ERROR" shape: a common first byte is the worst
+// case for a first-byte-only search.
+std::string corpus_pattern(const CorpusSpec& spec)
+{
+    static const char   base[] = "ERRORSTACKTRACEFAILURE";
+    std::string         pattern;
+
+    while (pattern.length() < spec.pattern_len)
+        pattern += base[pattern.length() % (sizeof(base) - 1)];
+    return pattern;
+}
+
+// Filler is random lower-case words. Each byte position starts a real match
+// with probability density / 1024, and a near miss (the pattern with its
+// last byte changed) just as often, so the search has to reject candidates.
+void generate_corpus(const CorpusSpec& spec, std::string& out)
+{
+    std::string     pattern;
+    std::string     near_miss;
+    std::size_t     column;
+    unsigned long   state;
+    unsigned long   threshold;
+    unsigned long   roll;
+
+    pattern = corpus_pattern(spec);
+    near_miss = pattern;
+    near_miss[near_miss.length() - 1] = 'x';
+    threshold = static_cast<unsigned long>(spec.density / 1024.0 * 1000000.0);
+    state = spec.seed;
+    column = 0;
+    out.clear();
+    out.reserve(spec.size + pattern.length());
+    while (out.length() < spec.size)
+    {
+        state = state * 6364136223846793005UL + 1442695040888963407UL;
+        roll = (state >> 33) % 1000000;
+        if (column >= spec.line_len)
+        {
+            out += '\n';
+            column = 0;
+            continue;
+        }
+        if (roll < threshold)
+            out += pattern;
+        else if (roll < 2 * threshold)
+            out += near_miss;
+        else
+            out += ((state >> 20) % 7 == 0) ? ' '
+                   : static_cast<char>('a' + (state >> 40) % 26);
+        column += (roll < 2 * threshold) ? pattern.length() : 1;
+    }
+    out.resize(spec.size);
+}
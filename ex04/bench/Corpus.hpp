@@ -0,0 +1,34 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   Corpus.hpp                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: marvin <marvin@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 06:40:13 by marvin            #+#    #+#             */
+/*   Updated: 2026/10/17 06:40:13 by marvin           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef CORPUS_HPP
+#define CORPUS_HPP
+
+#include <string>
+#include <cstddef>
+
+struct CorpusSpec
+{
+    std::size_t     size;
+    double          density;
+    std::size_t     pattern_len;
+    std::size_t     line_len;
+    unsigned int    seed;
+};
+
+void        default_corpus_spec(CorpusSpec& spec);
+bool        parse_corpus_option(int ac, char **av, int& i, CorpusSpec& spec);
+std::string corpus_pattern(const CorpusSpec& spec);
+void        generate_corpus(const CorpusSpec& spec, std::string& out);
+const char* corpus_usage(void);
+
+#endif
@@ -0,0 +1,49 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   gencorpus.cpp                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: marvin <marvin@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 06:40:13 by marvin            #+#    #+#             */
+/*   Updated: 2026/10/17 06:40:13 by marvin           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "Corpus.hpp"
+#include <iostream>
+#include <fstream>
+
+int main(int ac, char **av)
+{
+    CorpusSpec  spec;
+    std::string text;
+    int         i;
+
+    default_corpus_spec(spec);
+    if (ac < 2)
+    {
+        std::cout << "Usage: ./gencorpus <output> [options]\n"
+                  << corpus_usage();
+        return 1;
+    }
+    i = 2;
+    while (i < ac)
+    {
+        if (!parse_corpus_option(ac, av, i, spec))
+        {
+            std::cout << "Error: unknown option " << av[i] << "\n";
+            return 1;
+        }
+    }
+    generate_corpus(spec, text);
+    std::ofstream out(av[1], std::ios::out | std::ios::binary);
+    if (!out.is_open())
+    {
+        std::cout << "Error: cannot create output file\n";
+        return 1;
+    }
+    out.write(text.data(), text.length());
+    std::cout << "s1 = " << corpus_pattern(spec) << "\n";
+    return out.good() ? 0 : 1;
+}
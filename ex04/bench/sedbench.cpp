@@ -0,0 +1,319 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   sedbench.cpp                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: marvin <marvin@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 06:40:13 by marvin            #+#    #+#             */
+/*   Updated: 2026/10/18 14:12:30 by marvin           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../bench/Harness.hpp"
+#include "Corpus.hpp"
+#include "../Sed.hpp"
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <iomanip>
+#include <cstdlib>
+#include <cstdio>
+#include <new>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/resource.h>
+#include <sys/wait.h>
+
+// Every allocation made by the process goes through these two counters, so
+// a case can report how much churn each engine causes.
+static unsigned long g_allocs = 0;
+static unsigned long g_alloc_bytes = 0;
+
+void* operator new(std::size_t size) throw(std::bad_alloc)
+{
+    void* p;
+
+    __sync_fetch_and_add(&g_allocs, 1);
+    __sync_fetch_and_add(&g_alloc_bytes, size);
+    p = std::malloc(size ? size : 1);
+    if (!p)
+        throw std::bad_alloc();
+    return p;
+}
+
+void* operator new[](std::size_t size) throw(std::bad_alloc)
+{
+    return operator new(size);
+}
+
+void operator delete(void* p) throw()
+{
+    std::free(p);
+}
+
+void operator delete[](void* p) throw()
+{
+    std::free(p);
+}
+
+struct BenchConfig
+{
+    CorpusSpec      spec;
+    std::string     path;
+    std::string     s1;
+    std::string     s2;
+    std::size_t     s2_len;
+    std::size_t     matches;
+    unsigned int    reps;
+    unsigned int    threads;
+    bool            json;
+};
+
+struct Timing
+{
+    double          read_s;
+    double          replace_s;
+    double          write_s;
+    unsigned long   allocs;
+    unsigned long   alloc_bytes;
+};
+
+static void run_once(const std::string& engine, const BenchConfig& cfg,
+                     Timing& t)
+{
+    std::string     text;
+    std::string     out;
+    OutputBuffer    parallel;
+    AhoCorasick     rules;
+    MappedFile      map;
+    double          t0;
+    int             fd;
+
+    parallel.data = NULL;
+    parallel.size = 0;
+    t0 = harness_now_ns();
+    if (engine == "stream")
+    {
+        std::ifstream in(cfg.path.c_str(), std::ios::in | std::ios::binary);
+        std::ofstream os((cfg.path + ".replace").c_str(),
+                         std::ios::out | std::ios::binary);
+        stream_replace(in, os, cfg.s1, cfg.s2);
+        os.close();
+        t.replace_s = (harness_now_ns() - t0) / 1e9;
+        return;
+    }
+    if (engine == "mmap_writev")
+    {
+        fd = open(cfg.path.c_str(), O_RDONLY);
+        map_file(fd, map);
+        close(fd);
+        fd = open((cfg.path + ".replace").c_str(),
+                  O_WRONLY | O_CREAT | O_TRUNC, 0666);
+        writev_replace(map, fd, cfg.s1, cfg.s2);
+        close(fd);
+        unmap_file(map);
+        t.replace_s = (harness_now_ns() - t0) / 1e9;
+        return;
+    }
+    read_text_file(cfg.path, text);
+    t.read_s = (harness_now_ns() - t0) / 1e9;
+
+    t0 = harness_now_ns();
+    if (engine == "build_replaced")
+        build_replaced(text, cfg.s1, cfg.s2, out);
+    else if (engine == "in_place")
+        replace_in_place(text, cfg.s1, cfg.s2);
+    else if (engine == "aho_corasick")
+    {
+        rules.addRule(cfg.s1, cfg.s2);
+        rules.build();
+        rules.replaceAll(text.data(), text.length(), out);
+    }
+    else if (engine == "parallel")
+        parallel_replace(text.data(), text.length(), cfg.s1, cfg.s2,
+                         cfg.threads, parallel);
+    t.replace_s = (harness_now_ns() - t0) / 1e9;
+
+    t0 = harness_now_ns();
+    if (engine == "parallel")
+        write_text_file(cfg.path, parallel.data, parallel.size);
+    else
+        write_text_file(cfg.path, engine == "in_place" ? text : out);
+    free_output(parallel);
+    t.write_s = (harness_now_ns() - t0) / 1e9;
+}
+
+// Runs in a forked child so ru_maxrss is the peak of this engine alone.
+// Each phase keeps its best time over all repetitions.
+static void run_case(const std::string& engine, const BenchConfig& cfg,
+                     bool first)
+{
+    Timing          best;
+    Timing          t;
+    struct rusage   ru;
+    unsigned int    rep;
+    double          total;
+
+    best.read_s = 0;
+    best.replace_s = 0;
+    best.write_s = 0;
+    best.allocs = 0;
+    best.alloc_bytes = 0;
+    rep = 0;
+    while (rep < cfg.reps)
+    {
+        t.read_s = 0;
+        t.replace_s = 0;
+        t.write_s = 0;
+        g_allocs = 0;
+        g_alloc_bytes = 0;
+        run_once(engine, cfg, t);
+        t.allocs = g_allocs;
+        t.alloc_bytes = g_alloc_bytes;
+        if (rep == 0 || t.read_s + t.replace_s + t.write_s
+                        < best.read_s + best.replace_s + best.write_s)
+            best = t;
+        rep++;
+    }
+    getrusage(RUSAGE_SELF, &ru);
+    total = best.read_s + best.replace_s + best.write_s;
+
+    std::ostringstream line;
+    line << std::fixed << std::setprecision(6);
+    if (cfg.json)
+        line << (first ? "  " : ", ") << "{\"engine\": \"" << engine
+             << "\", \"kernel\": \"" << search_kernel_name()
+             << "\", \"size_bytes\": " << cfg.spec.size
+             << ", \"matches\": " << cfg.matches
+             << ", \"pattern_len\": " << cfg.s1.length()
+             << ", \"s2_len\": " << cfg.s2.length()
+             << ", \"line_len\": " << cfg.spec.line_len
+             << ", \"read_s\": " << best.read_s
+             << ", \"replace_s\": " << best.replace_s
+             << ", \"write_s\": " << best.write_s
+             << ", \"total_mbps\": " << std::setprecision(1)
+             << (total > 0 ? cfg.spec.size / total / 1e6 : 0.0)
+             << ", \"allocs\": " << best.allocs
+             << ", \"alloc_bytes\": " << best.alloc_bytes
+             << ", \"peak_rss_kb\": " << ru.ru_maxrss << "}\n";
+    else
+        line << engine << "," << search_kernel_name() << ","
+             << cfg.spec.size << "," << cfg.matches << ","
+             << cfg.s1.length() << "," << cfg.s2.length() << ","
+             << cfg.spec.line_len << ","
+             << best.read_s << "," << best.replace_s << ","
+             << best.write_s << "," << std::setprecision(1)
+             << (total > 0 ? cfg.spec.size / total / 1e6 : 0.0) << ","
+             << best.allocs << "," << best.alloc_bytes << ","
+             << ru.ru_maxrss << "\n";
+    std::cout << line.str() << std::flush;
+}
+
+static bool parse_args(int ac, char **av, BenchConfig& cfg)
+{
+    std::string opt;
+    int         i;
+
+    i = 1;
+    while (i < ac)
+    {
+        opt = av[i];
+        if (parse_corpus_option(ac, av, i, cfg.spec))
+            continue;
+        if (opt == "--json")
+            cfg.json = true;
+        else if (opt == "--csv")
+            cfg.json = false;
+        else if (i + 1 < ac && opt == "--reps")
+            cfg.reps = std::strtoul(av[++i], NULL, 10);
+        else if (i + 1 < ac && opt == "--threads")
+            cfg.threads = std::strtoul(av[++i], NULL, 10);
+        else if (i + 1 < ac && opt == "--s2-len")
+            cfg.s2_len = std::strtoul(av[++i], NULL, 10);
+        else if (i + 1 < ac && opt == "--dir")
+            cfg.path = std::string(av[++i]) + "/sedbench_corpus.txt";
+        else
+            return false;
+        i++;
+    }
+    if (cfg.reps == 0)
+        cfg.reps = 1;
+    return true;
+}
+
+int main(int ac, char **av)
+{
+    static const char*  engines[] = {
+        "build_replaced", "in_place", "aho_corasick",
+        "parallel", "stream", "mmap_writev"
+    };
+    BenchConfig         cfg;
+    std::string         text;
+    std::size_t         i;
+    bool                first;
+    pid_t               pid;
+    int                 status;
+
+    default_corpus_spec(cfg.spec);
+    cfg.path = "/tmp/sedbench_corpus.txt";
+    cfg.s2_len = 4;
+    cfg.reps = 3;
+    cfg.threads = 4;
+    cfg.json = false;
+    if (!parse_args(ac, av, cfg))
+    {
+        std::cout << "Usage: ./sedbench [--csv | --json] [--reps <n>] "
+                     "[--threads <n>] [--s2-len <n>] [--dir <dir>]\n"
+                  << corpus_usage();
+        return 1;
+    }
+    cfg.s1 = corpus_pattern(cfg.spec);
+    cfg.s2 = std::string(cfg.s2_len, '#');
+    generate_corpus(cfg.spec, text);
+    cfg.matches = count_matches(text.data(), text.length(), cfg.s1);
+    {
+        std::ofstream corpus(cfg.path.c_str(), std::ios::out | std::ios::binary);
+        corpus.write(text.data(), text.length());
+        if (!corpus.good())
+        {
+            std::cout << "Error: cannot create corpus in " << cfg.path << "\n";
+            return 1;
+        }
+    }
+    std::string().swap(text);
+
+    if (cfg.json)
+        std::cout << "[\n";
+    else
+        std::cout << "engine,kernel,size_bytes,matches,pattern_len,s2_len,"
+                     "line_len,read_s,replace_s,write_s,total_mbps,"
+                     "allocs,alloc_bytes,peak_rss_kb\n";
+    std::cout << std::flush;
+    first = true;
+    i = 0;
+    while (i < sizeof(engines) / sizeof(engines[0]))
+    {
+        if (std::string(engines[i]) == "in_place"
+            && cfg.s2.length() > cfg.s1.length())
+        {
+            i++;
+            continue;
+        }
+        pid = fork();
+        if (pid == 0)
+        {
+            run_case(engines[i], cfg, first);
+            std::exit(0);
+        }
+        if (pid > 0)
+            waitpid(pid, &status, 0);
+        first = false;
+        i++;
+    }
+    if (cfg.json)
+        std::cout << "]\n";
+    std::remove(cfg.path.c_str());
+    std::remove((cfg.path + ".replace").c_str());
+    return 0;
+}
@@ -6,30 +6,141 @@
 /*   By: marvin <marvin@student.42.fr>              +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2026/01/11 15:11:07 by marvin            #+#    #+#             */
-/*   Updated: 2026/01/11 15:11:07 by marvin           ###   ########.fr       */
+/*   Updated: 2026/10/18 11:52:20 by marvin           ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
 #include "Sed.hpp"
+#include "Batch.hpp"
+#include "Index.hpp"
 #include <iostream>
+#include <fstream>
+#include <cstdlib>
+#include <fcntl.h>
+#include <unistd.h>
 
-int main(int ac, char **av)
+// Set once from the leading I/O flags, then shared by every mode. Any
+// flag also turns off mmap, so every mode reads and writes through
+// read_text_file()/write_text_file() where the flags apply.
+static IoOptions g_io;
+static bool      g_io_set = false;
+
+static int run_mapped(const std::string& filename, MappedFile& map,
+                      const std::string& s1, const std::string& s2)
+{
+    int  out_fd;
+    bool ok;
+
+    out_fd = open((filename + ".replace").c_str(),
+                  O_WRONLY | O_CREAT | O_TRUNC, 0666);
+    if (out_fd < 0)
+    {
+        unmap_file(map);
+        std::cout << "Error: cannot create output file\n";
+        return 1;
+    }
+    ok = writev_replace(map, out_fd, s1, s2);
+    unmap_file(map);
+    if (close(out_fd) != 0 || !ok)
+    {
+        std::cout << "Error: failed while writing output file\n";
+        return 1;
+    }
+    return 0;
+}
+
+static int run_rules(const std::string& rules_file,
+                     const std::string& filename)
+{
+    AhoCorasick rules;
+    std::string text;
+
+    if (!read_rules_file(rules_file, rules))
+    {
+        std::cout << "Error: cannot read rules file "
+                     "(expected one <s1><TAB><s2> per line)\n";
+        return 1;
+    }
+    if (!read_text_file(filename, text, g_io))
+    {
+        std::cout << "Error: cannot open input file\n";
+        return 1;
+    }
+    if (!write_text_file(filename, build_replaced(text, rules), g_io))
+    {
+        std::cout << "Error: cannot create output file\n";
+        return 1;
+    }
+    return 0;
+}
+
+static int run_buffered(const std::string& filename,
+                        const std::string& s1, const std::string& s2)
 {
-    std::string filename;
-    std::string s1;
-    std::string s2;
     std::string text;
     std::string replaced;
 
-    if (ac != 4)
+    if (!read_text_file(filename, text, g_io))
+    {
+        std::cout << "Error: cannot open input file\n";
+        return 1;
+    }
+    build_replaced(text, s1, s2, replaced);
+    if (!write_text_file(filename, replaced, g_io))
+    {
+        std::cout << "Error: cannot create output file\n";
+        return 1;
+    }
+    return 0;
+}
+
+static int run_parallel(const std::string& filename, int fd,
+                        const std::string& s1, const std::string& s2,
+                        unsigned int threads)
+{
+    MappedFile      map;
+    std::string     text;
+    OutputBuffer    replaced;
+    bool            ok;
+
+    if (!g_io_set && map_file(fd, map))
+    {
+        close(fd);
+        ok = parallel_replace(map.data, map.size, s1, s2, threads, replaced);
+        unmap_file(map);
+    }
+    else
+    {
+        close(fd);
+        if (!read_text_file(filename, text, g_io))
+        {
+            std::cout << "Error: cannot open input file\n";
+            return 1;
+        }
+        ok = parallel_replace(text.data(), text.length(), s1, s2,
+                              threads, replaced);
+    }
+    if (!ok)
+    {
+        std::cout << "Error: out of memory\n";
+        return 1;
+    }
+    ok = write_text_file(filename, replaced.data, replaced.size, g_io);
+    free_output(replaced);
+    if (!ok)
     {
-        std::cout << "Usage: ./sedlosers <filename> <s1> <s2>\n";
+        std::cout << "Error: cannot create output file\n";
         return 1;
     }
+    return 0;
+}
 
-    filename = av[1];
-    s1 = av[2];
-    s2 = av[3];
+static int run_single(const std::string& filename,
+                      const std::string& s1, const std::string& s2,
+                      unsigned int threads)
+{
+    MappedFile  map;
+    int         fd;
 
     if (s1.empty())
     {
@@ -37,17 +148,280 @@ int main(int ac, char **av)
         return 1;
     }
 
-    if (!read_text_file(filename, text))
+    fd = open(filename.c_str(), O_RDONLY);
+    if (fd < 0)
+    {
+        std::cout << "Error: cannot open input file\n";
+        return 1;
+    }
+    if (threads > 1)
+        return run_parallel(filename, fd, s1, s2, threads);
+    if (g_io_set)
+    {
+        close(fd);
+        return run_buffered(filename, s1, s2);
+    }
+    if (map_file(fd, map))
+    {
+        close(fd);
+        return run_mapped(filename, map, s1, s2);
+    }
+    close(fd);
+
+    std::ifstream in(filename.c_str(), std::ios::in | std::ios::binary);
+    if (!in.is_open())
     {
         std::cout << "Error: cannot open input file\n";
         return 1;
     }
 
-    replaced = build_replaced(text, s1, s2);
-    if (!write_text_file(filename, replaced))
+    std::ofstream out((filename + ".replace").c_str(),
+                      std::ios::out | std::ios::binary);
+    if (!out.is_open())
     {
         std::cout << "Error: cannot create output file\n";
         return 1;
     }
+
+    if (!stream_replace(in, out, s1, s2))
+    {
+        std::cout << "Error: failed while writing output file\n";
+        return 1;
+    }
+    return 0;
+}
+
+// Maps the input when possible and falls back to reading it into text.
+static bool load_input(const std::string& filename, MappedFile& map,
+                       std::string& text)
+{
+    int fd;
+
+    map.data = NULL;
+    map.size = 0;
+    fd = open(filename.c_str(), O_RDONLY);
+    if (fd < 0)
+        return false;
+    if (!g_io_set && map_file(fd, map))
+    {
+        close(fd);
+        return true;
+    }
+    close(fd);
+    if (!read_text_file(filename, text, g_io))
+        return false;
+    map.data = text.data();
+    map.size = text.length();
+    return true;
+}
+
+// --count <filename> <s1>
+// --index <index> <filename> <s1>
+// --use-index <index> <filename> <s1> <s2>
+static int run_index_mode(const std::string& mode, int ac, char **av)
+{
+    MappedFile  map;
+    MatchIndex  index;
+    std::string text;
+    std::string replaced;
+    std::string s1;
+    int         first;
+    bool        owned;
+    bool        ok;
+
+    first = (mode == "--count") ? 2 : 3;
+    if ((mode == "--use-index" && ac != 6) || (mode != "--use-index"
+        && ac != first + 2))
+    {
+        std::cout << "Error: wrong number of arguments for " << mode << "\n";
+        return 1;
+    }
+    s1 = av[first + 1];
+    if (s1.empty())
+    {
+        std::cout << "Error: s1 cannot be empty\n";
+        return 1;
+    }
+    if (!load_input(av[first], map, text))
+    {
+        std::cout << "Error: cannot open input file\n";
+        return 1;
+    }
+    owned = map.data != text.data();
+    if (mode == "--use-index")
+    {
+        ok = read_match_index(av[2], index)
+            && apply_match_index(map.data, map.size, index, s1, av[5],
+                                 replaced);
+        if (owned)
+            unmap_file(map);
+        if (!ok)
+        {
+            std::cout << "Error: index file is missing or does not match "
+                         "this input\n";
+            return 1;
+        }
+        if (!write_text_file(av[first], replaced, g_io))
+        {
+            std::cout << "Error: cannot create output file\n";
+            return 1;
+        }
+        return 0;
+    }
+    if (mode == "--count")
+        std::cout << count_matches(map.data, map.size, s1) << "\n";
+    else
+        std::cout << build_match_index(map.data, map.size, s1, index) << "\n";
+    if (owned)
+        unmap_file(map);
+    if (mode == "--index" && !write_match_index(av[2], index))
+    {
+        std::cout << "Error: cannot create index file\n";
+        return 1;
+    }
+    return 0;
+}
+
+static int usage(void)
+{
+    std::cout << "Usage: ./sedlosers [io] <filename> <s1> <s2>\n"
+                 "       ./sedlosers [io] -j <threads> <filename> <s1> <s2>\n"
+                 "       ./sedlosers [io] -f <rules> <filename>\n"
+                 "       ./sedlosers [io] --batch [-j <threads>] "
+                 "(-f <rules> | <s1> <s2>) <path>...\n"
+                 "       ./sedlosers [io] --count <filename> <s1>\n"
+                 "       ./sedlosers [io] --index <index> <filename> <s1>\n"
+                 "       ./sedlosers [io] --use-index <index> <filename> "
+                 "<s1> <s2>\n"
+                 "io: --buffer <bytes> | --direct | --no-fadvise "
+                 "(read()/write() instead of mmap)\n";
+    return 1;
+}
+
+// --batch [-j <threads>] (-f <rules> | <s1> <s2>) <path>...
+static int run_batch_mode(int ac, char **av)
+{
+    BatchJob    job;
+    AhoCorasick rules;
+    bool        missing;
+    int         i;
+
+    missing = false;
+    job.io = g_io;
+    job.rules = NULL;
+    job.threads = 1;
+    i = 2;
+    if (i + 1 < ac && std::string(av[i]) == "-j")
+    {
+        if (std::atoi(av[i + 1]) < 1)
+        {
+            std::cout << "Error: -j expects a positive thread count\n";
+            return 1;
+        }
+        job.threads = std::atoi(av[i + 1]);
+        i += 2;
+    }
+    if (i + 1 < ac && std::string(av[i]) == "-f")
+    {
+        if (!read_rules_file(av[i + 1], rules))
+        {
+            std::cout << "Error: cannot read rules file "
+                         "(expected one <s1><TAB><s2> per line)\n";
+            return 1;
+        }
+        job.rules = &rules;
+        i += 2;
+    }
+    else if (i + 2 < ac)
+    {
+        job.s1 = av[i];
+        job.s2 = av[i + 1];
+        if (job.s1.empty())
+        {
+            std::cout << "Error: s1 cannot be empty\n";
+            return 1;
+        }
+        i += 2;
+    }
+    else
+        return usage();
+    if (i >= ac)
+        return usage();
+    while (i < ac)
+    {
+        if (!collect_files(av[i], job.files))
+        {
+            std::cout << "Error: cannot read " << av[i] << "\n";
+            missing = true;
+        }
+        i++;
+    }
+    if (run_batch(job) > 0 || missing)
+        return 1;
     return 0;
 }
+
+// Leading flags shared by all modes: --buffer <bytes>, --direct and
+// --no-fadvise. Returns false on a malformed flag.
+static bool parse_io_options(int& ac, char **&av)
+{
+    std::string opt;
+    long        size;
+
+    while (ac > 1)
+    {
+        opt = av[1];
+        if (opt == "--direct")
+            g_io.direct = true;
+        else if (opt == "--no-fadvise")
+            g_io.sequential = false;
+        else if (opt == "--buffer" && ac > 2)
+        {
+            size = std::atol(av[2]);
+            if (size < 4096)
+                return false;
+            g_io.buffer_size = size;
+            ac--;
+            av++;
+        }
+        else
+            return opt != "--buffer";
+        g_io_set = true;
+        ac--;
+        av++;
+    }
+    return true;
+}
+
+int main(int ac, char **av)
+{
+    int threads;
+
+    if (!parse_io_options(ac, av))
+    {
+        std::cout << "Error: --buffer expects a size of at least 4096 bytes\n";
+        return 1;
+    }
+
+    if (ac > 1 && std::string(av[1]) == "--batch")
+        return run_batch_mode(ac, av);
+    if (ac > 1 && (std::string(av[1]) == "--count"
+                   || std::string(av[1]) == "--index"
+                   || std::string(av[1]) == "--use-index"))
+        return run_index_mode(av[1], ac, av);
+    if (ac == 4 && std::string(av[1]) == "-f")
+        return run_rules(av[2], av[3]);
+    if (ac == 6 && std::string(av[1]) == "-j")
+    {
+        threads = std::atoi(av[2]);
+        if (threads < 1)
+        {
+            std::cout << "Error: -j expects a positive thread count\n";
+            return 1;
+        }
+        return run_single(av[3], av[4], av[5], threads);
+    }
+    if (ac != 4)
+        return usage();
+    return run_single(av[1], av[2], av[3], 1);
+}
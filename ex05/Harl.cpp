@@ -6,61 +6,191 @@
 /*   By: marvin <marvin@student.42.fr>              +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2026/01/11 18:30:22 by marvin            #+#    #+#             */
-/*   Updated: 2026/01/11 18:30:22 by marvin           ###   ########.fr       */
+/*   Updated: 2026/10/18 15:20:05 by marvin           ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
 #include "Harl.hpp"
+#include "HarlSink.hpp"
 #include <iostream>
+#include <cerrno>
+#include <time.h>
+#include <unistd.h>
+
+static const char* const g_labels[Harl::LEVEL_COUNT] = {
+    "[DEBUG]",
+    "[INFO]",
+    "[WARNING]",
+    "[ERROR]"
+};
+
+static const char* const g_messages[Harl::LEVEL_COUNT] = {
+    "I love having extra bacon for my 7XL-double-cheese-triple-pickle-special ketchup burger. I really do!",
+    "I cannot believe adding extra bacon costs more money. You didn't put enough bacon in my burger! If you did, I wouldn't be asking for more!",
+    "I think I deserve to have some extra bacon for free. I've been coming for years, whereas you started working here just last month.",
+    "This is unacceptable! I want to speak to the manager now."
+};
+
+// Appends exactly what debug()/info()/warning()/error() print.
+void Harl::format(Level level, std::string& out)
+{
+    out += g_labels[level];
+    out += '\n';
+    out += g_messages[level];
+    out += '\n';
+}
 
 void Harl::debug(void)
 {
-    std::cout << "[DEBUG]" << std::endl;
-    std::cout << "I love having extra bacon for my 7XL-double-cheese-triple-pickle-special ketchup burger. I really do!" << std::endl;
+    std::cout << g_labels[DEBUG] << std::endl;
+    std::cout << g_messages[DEBUG] << std::endl;
 }
 
 void Harl::info(void)
 {
-    std::cout << "[INFO]" << std::endl;
-    std::cout << "I cannot believe adding extra bacon costs more money. You didn't put enough bacon in my burger! If you did, I wouldn't be asking for more!" << std::endl;
+    std::cout << g_labels[INFO] << std::endl;
+    std::cout << g_messages[INFO] << std::endl;
 }
 
 void Harl::warning(void)
 {
-    std::cout << "[WARNING]" << std::endl;
-    std::cout << "I think I deserve to have some extra bacon for free. I've been coming for years, whereas you started working here just last month." << std::endl;
+    std::cout << g_labels[WARNING] << std::endl;
+    std::cout << g_messages[WARNING] << std::endl;
 }
 
 void Harl::error(void)
 {
-    std::cout << "[ERROR]" << std::endl;
-    std::cout << "This is unacceptable! I want to speak to the manager now." << std::endl;
+    std::cout << g_labels[ERROR] << std::endl;
+    std::cout << g_messages[ERROR] << std::endl;
 }
 
-void Harl::complain(std::string level)
+int Harl::threshold = Harl::DEBUG;
+
+Harl::Harl(void)
+{
+    setSink(NULL);
+}
+
+// Built once at load time instead of on every complain() call.
+void (Harl::* const Harl::handlers[Harl::LEVEL_COUNT])(void) = {
+    &Harl::debug,
+    &Harl::info,
+    &Harl::warning,
+    &Harl::error
+};
+
+// The four names differ in length or first letter, so one switch picks the
+// only possible candidate and a single compare confirms it.
+Harl::Level Harl::levelFromString(const std::string& level)
+{
+    Level       guess;
+    const char* name;
+
+    switch (level.length())
+    {
+        case 4:
+            guess = INFO;
+            name = "INFO";
+            break;
+        case 5:
+            guess = (level[0] == 'D') ? DEBUG : ERROR;
+            name = (level[0] == 'D') ? "DEBUG" : "ERROR";
+            break;
+        case 7:
+            guess = WARNING;
+            name = "WARNING";
+            break;
+        default:
+            return LEVEL_COUNT;
+    }
+    if (level.compare(name) != 0)
+        return LEVEL_COUNT;
+    return guess;
+}
+
+void Harl::setThreshold(Level level)
+{
+    __atomic_store_n(&threshold, level, __ATOMIC_RELAXED);
+}
+
+Harl::Level Harl::getThreshold(void)
+{
+    return static_cast<Level>(__atomic_load_n(&threshold, __ATOMIC_RELAXED));
+}
+
+// The threshold check comes first, so a filtered-out call costs one
+// relaxed load and a compare.
+void Harl::complain(Level level)
+{
+    if (!isEnabled(level) || level >= LEVEL_COUNT)
+        return;
+    if (sinks[level])
+        sinks[level]->record(level);
+    else
+        (this->*handlers[level])();
+}
+
+// Sinks are borrowed, not owned. NULL sends a level back to std::cout.
+void Harl::setSink(HarlSink* sink)
+{
+    int i;
+
+    i = 0;
+    while (i < LEVEL_COUNT)
+        sinks[i++] = sink;
+}
+
+void Harl::setSink(Level level, HarlSink* sink)
 {
-    std::string levels[4] = {
-        "DEBUG",
-        "INFO",
-        "WARNING",
-        "ERROR"
-    };
-
-    void (Harl::*funcs[4])(void) = {
-        &Harl::debug,
-        &Harl::info,
-        &Harl::warning,
-        &Harl::error
-    };
-
-    int i = 0;
-    while (i < 4)
+    if (level < LEVEL_COUNT)
+        sinks[level] = sink;
+}
+
+void Harl::flush(void)
+{
+    int i;
+    int j;
+
+    i = 0;
+    while (i < LEVEL_COUNT)
     {
-        if (level == levels[i])
-        {
-            (this->*funcs[i])();
-            return;
-        }
+        j = 0;
+        while (j < i && sinks[j] != sinks[i])
+            j++;
+        if (sinks[i] && j == i)
+            sinks[i]->flush();
         i++;
     }
+    std::cout.flush();
+}
+
+void Harl::complain(std::string level)
+{
+    complain(levelFromString(level));
+}
+
+unsigned long long harl_now_ns(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return static_cast<unsigned long long>(ts.tv_sec) * 1000000000ULL
+        + ts.tv_nsec;
+}
+
+bool harl_write_all(int fd, const char* data, std::size_t len)
+{
+    ssize_t put;
+
+    while (len > 0)
+    {
+        put = write(fd, data, len);
+        if (put < 0 && errno == EINTR)
+            continue;
+        if (put <= 0)
+            return false;
+        data += put;
+        len -= put;
+    }
+    return true;
 }
@@ -6,7 +6,7 @@
 /*   By: marvin <marvin@student.42.fr>              +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2026/01/11 18:30:25 by marvin            #+#    #+#             */
-/*   Updated: 2026/01/11 18:30:25 by marvin           ###   ########.fr       */
+/*   Updated: 2026/10/18 15:20:05 by marvin           ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -14,18 +14,92 @@
 #define HARL_HPP
 
 #include <string>
+#include <cstddef>
+
+class HarlSink;
+
+// Levels below this are compiled out of Harl::complainAt<>():
+// 0 DEBUG, 1 INFO, 2 WARNING, 3 ERROR. Build with -DHARL_MIN_LEVEL=2 to
+// keep only WARNING and ERROR.
+#ifndef HARL_MIN_LEVEL
+# define HARL_MIN_LEVEL 0
+#endif
 
 class Harl
 {
+   public:
+      enum Level
+      {
+         DEBUG,
+         INFO,
+         WARNING,
+         ERROR,
+         LEVEL_COUNT
+      };
+
    private:
+      static void (Harl::* const handlers[LEVEL_COUNT])(void);
+      static int  threshold;
+
+      HarlSink*   sinks[LEVEL_COUNT];
+
       void  debug(void);
       void  info(void);
       void  warning(void);
       void  error(void);
 
    public:
+      Harl(void);
+
+      static Level         levelFromString(const std::string& level);
+      static void          format(Level level, std::string& out);
+
+      static void          setThreshold(Level level);
+      static Level         getThreshold(void);
+      static bool          isEnabled(Level level);
+
+      void  setSink(HarlSink* sink);
+      void  setSink(Level level, HarlSink* sink);
+      void  flush(void);
+
       void  complain(std::string level);
+      void  complain(Level level);
+
+      template <Level L>
+      void  complainAt(void);
 
 };
 
+template <bool Enabled>
+struct HarlGate
+{
+   static void complain(Harl& harl, Harl::Level level)
+   {
+      harl.complain(level);
+   }
+};
+
+template <>
+struct HarlGate<false>
+{
+   static void complain(Harl&, Harl::Level)
+   {
+   }
+};
+
+template <Harl::Level L>
+void Harl::complainAt(void)
+{
+   HarlGate<(L >= HARL_MIN_LEVEL)>::complain(*this, L);
+}
+
+unsigned long long  harl_now_ns(void);
+bool                harl_write_all(int fd, const char* data, std::size_t len);
+
+inline bool Harl::isEnabled(Level level)
+{
+   return level >= HARL_MIN_LEVEL
+      && level >= __atomic_load_n(&threshold, __ATOMIC_RELAXED);
+}
+
 #endif
\ No newline at end of file
@@ -0,0 +1,209 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   HarlAsync.cpp                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: marvin <marvin@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 11:52:30 by marvin            #+#    #+#             */
+/*   Updated: 2026/10/17 14:37:19 by marvin           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "HarlAsync.hpp"
+#include <sched.h>
+#include <time.h>
+#include <unistd.h>
+
+// The consumer writes once this much text has piled up, or when the queue
+// runs dry, whichever comes first.
+static const std::size_t BATCH_BYTES = 64 * 1024;
+
+static void sleep_us(long us)
+{
+    struct timespec ts;
+
+    ts.tv_sec = 0;
+    ts.tv_nsec = us * 1000;
+    nanosleep(&ts, NULL);
+}
+
+// Bounded lock-free queue (Vyukov): every slot carries a sequence number
+// that tells producers and the consumer whose turn it is, so a push is one
+// CAS on enqueue_pos plus two plain stores. Capacity is rounded up to a
+// power of two.
+HarlAsync::HarlAsync(std::size_t capacity, FullPolicy policy, int fd)
+    : slots(NULL), mask(0), enqueue_pos(0), dequeue_pos(0), completed(0),
+      drops(0), policy(policy), fd(fd), stopping(0), running(false)
+{
+    std::size_t size;
+    std::size_t i;
+
+    size = 2;
+    while (size < capacity)
+        size <<= 1;
+    slots = new Slot[size];
+    mask = size - 1;
+    i = 0;
+    while (i < size)
+    {
+        slots[i].sequence = i;
+        i++;
+    }
+    running = pthread_create(&consumer, NULL, &HarlAsync::consumerMain,
+                             this) == 0;
+}
+
+HarlAsync::~HarlAsync()
+{
+    __atomic_store_n(&stopping, 1, __ATOMIC_RELEASE);
+    if (running)
+        pthread_join(consumer, NULL);
+    delete[] slots;
+}
+
+bool HarlAsync::tryPush(const HarlRecord& record)
+{
+    unsigned long   pos;
+    unsigned long   seq;
+    long            diff;
+    Slot*           slot;
+
+    pos = __atomic_load_n(&enqueue_pos, __ATOMIC_RELAXED);
+    while (true)
+    {
+        slot = &slots[pos & mask];
+        seq = __atomic_load_n(&slot->sequence, __ATOMIC_ACQUIRE);
+        diff = static_cast<long>(seq) - static_cast<long>(pos);
+        if (diff == 0)
+        {
+            if (__atomic_compare_exchange_n(&enqueue_pos, &pos, pos + 1, true,
+                                            __ATOMIC_RELAXED,
+                                            __ATOMIC_RELAXED))
+                break;
+        }
+        else if (diff < 0)
+            return false;
+        else
+            pos = __atomic_load_n(&enqueue_pos, __ATOMIC_RELAXED);
+    }
+    slot->record = record;
+    __atomic_store_n(&slot->sequence, pos + 1, __ATOMIC_RELEASE);
+    return true;
+}
+
+bool HarlAsync::tryPop(HarlRecord& record)
+{
+    unsigned long   pos;
+    unsigned long   seq;
+    Slot*           slot;
+
+    pos = dequeue_pos;
+    slot = &slots[pos & mask];
+    seq = __atomic_load_n(&slot->sequence, __ATOMIC_ACQUIRE);
+    if (seq != pos + 1)
+        return false;
+    record = slot->record;
+    __atomic_store_n(&slot->sequence, pos + mask + 1, __ATOMIC_RELEASE);
+    dequeue_pos = pos + 1;
+    return true;
+}
+
+// Formats records into one big buffer and writes it with a single write()
+// per batch. Sleeps with a growing back-off while there is nothing to do.
+void HarlAsync::consume(void)
+{
+    std::string     out;
+    HarlRecord      record;
+    unsigned long   batch;
+    long            backoff;
+    bool            last;
+
+    out.reserve(BATCH_BYTES + 512);
+    backoff = 50;
+    while (true)
+    {
+        last = __atomic_load_n(&stopping, __ATOMIC_ACQUIRE) != 0;
+        batch = 0;
+        while (tryPop(record))
+        {
+            Harl::format(static_cast<Harl::Level>(record.level), out);
+            batch++;
+            if (out.length() >= BATCH_BYTES)
+            {
+                harl_write_all(fd, out.data(), out.length());
+                out.clear();
+                __atomic_add_fetch(&completed, batch, __ATOMIC_RELEASE);
+                batch = 0;
+            }
+        }
+        if (!out.empty())
+            harl_write_all(fd, out.data(), out.length());
+        out.clear();
+        if (batch > 0)
+        {
+            __atomic_add_fetch(&completed, batch, __ATOMIC_RELEASE);
+            backoff = 50;
+            continue;
+        }
+        if (last)
+            break;
+        sleep_us(backoff);
+        if (backoff < 1000)
+            backoff *= 2;
+    }
+}
+
+void* HarlAsync::consumerMain(void* self)
+{
+    static_cast<HarlAsync*>(self)->consume();
+    return NULL;
+}
+
+// Without a consumer thread (pthread_create failed) records are written
+// synchronously, so nothing is lost and nobody waits forever.
+bool HarlAsync::complain(Harl::Level level)
+{
+    HarlRecord  record;
+    std::string line;
+
+    if (!Harl::isEnabled(level) || level >= Harl::LEVEL_COUNT)
+        return false;
+    record.timestamp_ns = harl_now_ns();
+    record.level = level;
+    if (!running)
+    {
+        Harl::format(level, line);
+        return harl_write_all(fd, line.data(), line.length());
+    }
+    if (tryPush(record))
+        return true;
+    if (policy == DROP_COUNT)
+        __atomic_add_fetch(&drops, 1, __ATOMIC_RELAXED);
+    if (policy != BLOCK)
+        return false;
+    while (!tryPush(record))
+        sched_yield();
+    return true;
+}
+
+bool HarlAsync::complain(const std::string& level)
+{
+    return complain(Harl::levelFromString(level));
+}
+
+// Returns once everything pushed before the call has been written.
+void HarlAsync::flush(void)
+{
+    unsigned long target;
+
+    target = __atomic_load_n(&enqueue_pos, __ATOMIC_ACQUIRE);
+    while (running
+           && __atomic_load_n(&completed, __ATOMIC_ACQUIRE) < target)
+        sleep_us(50);
+}
+
+unsigned long HarlAsync::dropped(void) const
+{
+    return __atomic_load_n(&drops, __ATOMIC_RELAXED);
+}
@@ -0,0 +1,78 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   HarlAsync.hpp                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: marvin <marvin@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 11:52:30 by marvin            #+#    #+#             */
+/*   Updated: 2026/10/17 14:37:19 by marvin           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef HARLASYNC_HPP
+#define HARLASYNC_HPP
+
+#include <string>
+#include <cstddef>
+#include <pthread.h>
+#include "Harl.hpp"
+
+struct HarlRecord
+{
+   unsigned long long   timestamp_ns;
+   unsigned int         level;
+};
+
+class HarlAsync
+{
+   public:
+      enum FullPolicy
+      {
+         BLOCK,
+         DROP,
+         DROP_COUNT
+      };
+
+   private:
+      struct Slot
+      {
+         unsigned long  sequence;
+         HarlRecord     record;
+      };
+
+      Slot*          slots;
+      unsigned long  mask;
+      char           pad0[64 - sizeof(Slot*) - sizeof(unsigned long)];
+      unsigned long  enqueue_pos;
+      char           pad1[64 - sizeof(unsigned long)];
+      unsigned long  dequeue_pos;
+      unsigned long  completed;
+      char           pad2[64 - 2 * sizeof(unsigned long)];
+      unsigned long  drops;
+      FullPolicy     policy;
+      int            fd;
+      int            stopping;
+      bool           running;
+      pthread_t      consumer;
+
+      HarlAsync(const HarlAsync&);
+      HarlAsync& operator=(const HarlAsync&);
+
+      bool           tryPush(const HarlRecord& record);
+      bool           tryPop(HarlRecord& record);
+      void           consume(void);
+      static void*   consumerMain(void* self);
+
+   public:
+      HarlAsync(std::size_t capacity = 4096, FullPolicy policy = BLOCK,
+                int fd = 1);
+      ~HarlAsync();
+
+      bool           complain(Harl::Level level);
+      bool           complain(const std::string& level);
+      void           flush(void);
+      unsigned long  dropped(void) const;
+};
+
+#endif
@@ -0,0 +1,192 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   HarlBinary.cpp                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: marvin <marvin@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 15:12:40 by marvin            #+#    #+#             */
+/*   Updated: 2026/10/18 15:12:48 by marvin           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "HarlBinary.hpp"
+#include <cerrno>
+#include <cstdio>
+#include <fcntl.h>
+#include <unistd.h>
+
+const char HarlBinary::MAGIC[8] = {'H', 'A', 'R', 'L', 'B', 'I', 'N', '1'};
+
+HarlBinary::HarlBinary(const std::string& path, std::size_t flush_bytes)
+    : fd(-1), base_ns(0), flush_bytes(flush_bytes)
+{
+    fd = open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0666);
+    buffer.reserve(flush_bytes + 16);
+}
+
+HarlBinary::~HarlBinary()
+{
+    flush();
+    if (fd >= 0)
+        close(fd);
+}
+
+bool HarlBinary::isOpen(void) const
+{
+    return fd >= 0;
+}
+
+void HarlBinary::putWord(unsigned long long word)
+{
+    char    bytes[8];
+    int     i;
+
+    i = 0;
+    while (i < 8)
+    {
+        bytes[i] = static_cast<char>((word >> (8 * i)) & 0xff);
+        i++;
+    }
+    buffer.append(bytes, 8);
+}
+
+// The header is written lazily so its base time is the first record's.
+void HarlBinary::push(Harl::Level level, bool has_arg, unsigned long long arg)
+{
+    unsigned long long now;
+
+    if (fd < 0 || !Harl::isEnabled(level) || level >= Harl::LEVEL_COUNT)
+        return;
+    now = harl_now_ns();
+    if (base_ns == 0)
+    {
+        base_ns = now;
+        buffer.append(MAGIC, sizeof(MAGIC));
+        putWord(base_ns);
+    }
+    putWord(((now - base_ns) << 8) | level | (has_arg ? ARG_FLAG : 0));
+    if (has_arg)
+        putWord(arg);
+    if (buffer.length() >= flush_bytes)
+        flush();
+}
+
+void HarlBinary::complain(Harl::Level level)
+{
+    push(level, false, 0);
+}
+
+void HarlBinary::complain(Harl::Level level, unsigned long long arg)
+{
+    push(level, true, arg);
+}
+
+void HarlBinary::complain(const std::string& level)
+{
+    push(Harl::levelFromString(level), false, 0);
+}
+
+bool HarlBinary::flush(void)
+{
+    bool ok;
+
+    if (fd < 0 || buffer.empty())
+        return fd >= 0;
+    ok = harl_write_all(fd, buffer.data(), buffer.length());
+    buffer.clear();
+    return ok;
+}
+
+// eof is set only when the file ends before the first byte of the word;
+// a word cut short is an error like any other.
+static bool read_exact(int fd, unsigned char* dst, std::size_t len,
+                       bool& eof)
+{
+    ssize_t     got;
+    std::size_t want;
+
+    eof = false;
+    want = len;
+    while (len > 0)
+    {
+        got = read(fd, dst, len);
+        if (got < 0 && errno == EINTR)
+            continue;
+        if (got <= 0)
+        {
+            eof = (got == 0 && len == want);
+            return false;
+        }
+        dst += got;
+        len -= got;
+    }
+    return true;
+}
+
+static unsigned long long get_word(const unsigned char* p)
+{
+    unsigned long long  v;
+    int                 i;
+
+    v = 0;
+    i = 7;
+    while (i >= 0)
+        v = (v << 8) | p[i--];
+    return v;
+}
+
+// Expands a binary log back into the text Harl prints. With annotate on,
+// each record is preceded by its time offset and argument, if any.
+bool harl_decode(int in_fd, int out_fd, bool annotate)
+{
+    unsigned char       word[8];
+    std::string         out;
+    unsigned long long  rec;
+    unsigned long long  arg;
+    unsigned int        id;
+    bool                eof;
+    char                note[80];
+
+    if (!read_exact(in_fd, word, 8, eof))
+        return eof;
+    if (std::string(reinterpret_cast<char*>(word), 8)
+        != std::string(HarlBinary::MAGIC, 8)
+        || !read_exact(in_fd, word, 8, eof))
+        return false;
+    while (read_exact(in_fd, word, 8, eof))
+    {
+        rec = get_word(word);
+        id = rec & HarlBinary::ID_MASK;
+        arg = 0;
+        if ((rec & HarlBinary::ARG_FLAG) && !read_exact(in_fd, word, 8, eof))
+            return false;
+        if (rec & HarlBinary::ARG_FLAG)
+            arg = get_word(word);
+        if (id >= Harl::LEVEL_COUNT)
+            return false;
+        if (annotate)
+        {
+            std::snprintf(note, sizeof(note), "+%llu.%09llus",
+                          (rec >> 8) / 1000000000ULL,
+                          (rec >> 8) % 1000000000ULL);
+            out += note;
+            if (rec & HarlBinary::ARG_FLAG)
+            {
+                std::snprintf(note, sizeof(note), " arg=%llu", arg);
+                out += note;
+            }
+            out += '\n';
+        }
+        Harl::format(static_cast<Harl::Level>(id), out);
+        if (out.length() >= 64 * 1024)
+        {
+            if (!harl_write_all(out_fd, out.data(), out.length()))
+                return false;
+            out.clear();
+        }
+    }
+    if (!harl_write_all(out_fd, out.data(), out.length()))
+        return false;
+    return eof;
+}
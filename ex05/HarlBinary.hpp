@@ -0,0 +1,57 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   HarlBinary.hpp                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: marvin <marvin@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 15:12:40 by marvin            #+#    #+#             */
+/*   Updated: 2026/10/17 15:12:40 by marvin           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef HARLBINARY_HPP
+#define HARLBINARY_HPP
+
+#include <string>
+#include <cstddef>
+#include "Harl.hpp"
+
+// On-disk layout, all little-endian:
+//   header  "HARLBIN1" then the u64 steady-clock time of the first record
+//   record  one u64: bits 0-6 message id (the Harl::Level), bit 7 set when
+//           an argument record follows, bits 8-63 nanoseconds since the
+//           header time
+//   arg     one u64 holding the argument value
+class HarlBinary
+{
+   private:
+      int                  fd;
+      unsigned long long   base_ns;
+      std::string          buffer;
+      std::size_t          flush_bytes;
+
+      HarlBinary(const HarlBinary&);
+      HarlBinary& operator=(const HarlBinary&);
+
+      void  putWord(unsigned long long word);
+      void  push(Harl::Level level, bool has_arg, unsigned long long arg);
+
+   public:
+      static const char           MAGIC[8];
+      static const unsigned int   ARG_FLAG = 0x80;
+      static const unsigned int   ID_MASK = 0x7f;
+
+      HarlBinary(const std::string& path, std::size_t flush_bytes = 64 * 1024);
+      ~HarlBinary();
+
+      bool  isOpen(void) const;
+      void  complain(Harl::Level level);
+      void  complain(Harl::Level level, unsigned long long arg);
+      void  complain(const std::string& level);
+      bool  flush(void);
+};
+
+bool harl_decode(int in_fd, int out_fd, bool annotate);
+
+#endif
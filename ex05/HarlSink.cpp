@@ -0,0 +1,185 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   HarlSink.cpp                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: marvin <marvin@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 15:48:05 by marvin            #+#    #+#             */
+/*   Updated: 2026/10/18 12:47:15 by marvin           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "HarlSink.hpp"
+#include <cstdio>
+#include <cstring>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+HarlSink::~HarlSink()
+{
+}
+
+// The record is formatted into a reused buffer so each complaint is one
+// write() and, after the first call, no allocation.
+void HarlSink::record(Harl::Level level)
+{
+    scratch.clear();
+    Harl::format(level, scratch);
+    write(scratch.data(), scratch.length());
+}
+
+HarlFdSink::HarlFdSink(int fd, std::size_t capacity, bool owns_fd)
+    : fd(fd), owns_fd(owns_fd), capacity(capacity)
+{
+    buffer.reserve(capacity);
+}
+
+HarlFdSink::~HarlFdSink()
+{
+    flush();
+    if (owns_fd && fd >= 0)
+        close(fd);
+}
+
+void HarlFdSink::write(const char* data, std::size_t len)
+{
+    if (buffer.length() + len > capacity)
+        flush();
+    if (len >= capacity)
+    {
+        if (fd >= 0)
+            harl_write_all(fd, data, len);
+        return;
+    }
+    buffer.append(data, len);
+}
+
+void HarlFdSink::flush(void)
+{
+    if (fd >= 0 && !buffer.empty())
+        harl_write_all(fd, buffer.data(), buffer.length());
+    buffer.clear();
+}
+
+HarlFileSink::HarlFileSink(const std::string& path,
+                           unsigned long long max_bytes,
+                           unsigned int max_seconds, unsigned int keep,
+                           std::size_t capacity)
+    : HarlFdSink(-1, capacity, true), path(path), max_bytes(max_bytes),
+      max_ns(max_seconds * 1000000000ULL), keep(keep), written(0),
+      opened_ns(0)
+{
+    open(false);
+}
+
+bool HarlFileSink::open(bool truncate)
+{
+    struct stat st;
+
+    fd = ::open(path.c_str(),
+                O_WRONLY | O_CREAT | O_APPEND | (truncate ? O_TRUNC : 0),
+                0666);
+    written = 0;
+    if (fd >= 0 && fstat(fd, &st) == 0)
+        written = st.st_size;
+    opened_ns = harl_now_ns();
+    return fd >= 0;
+}
+
+bool HarlFileSink::isOpen(void) const
+{
+    return fd >= 0;
+}
+
+void HarlFileSink::rotate(void)
+{
+    unsigned int    i;
+    char            from[4096];
+    char            to[4096];
+
+    flush();
+    if (fd >= 0)
+        close(fd);
+    i = keep;
+    while (i > 1)
+    {
+        std::snprintf(from, sizeof(from), "%s.%u", path.c_str(), i - 1);
+        std::snprintf(to, sizeof(to), "%s.%u", path.c_str(), i);
+        std::rename(from, to);
+        i--;
+    }
+    if (keep > 0)
+    {
+        std::snprintf(to, sizeof(to), "%s.1", path.c_str());
+        std::rename(path.c_str(), to);
+    }
+    open(true);
+}
+
+// Limits are checked per record, so a record never straddles two files.
+void HarlFileSink::write(const char* data, std::size_t len)
+{
+    if (written > 0
+        && ((max_bytes && written + len > max_bytes)
+            || (max_ns && harl_now_ns() - opened_ns >= max_ns)))
+        rotate();
+    written += len;
+    HarlFdSink::write(data, len);
+}
+
+HarlRingSink::HarlRingSink(std::size_t capacity)
+    : ring(capacity ? capacity : 1), total(0)
+{
+}
+
+void HarlRingSink::write(const char* data, std::size_t len)
+{
+    std::size_t size;
+    std::size_t pos;
+    std::size_t chunk;
+
+    size = ring.size();
+    if (len > size)
+    {
+        total += len - size;
+        data += len - size;
+        len = size;
+    }
+    while (len > 0)
+    {
+        pos = total % size;
+        chunk = (size - pos < len) ? size - pos : len;
+        std::memcpy(&ring[pos], data, chunk);
+        total += chunk;
+        data += chunk;
+        len -= chunk;
+    }
+}
+
+void HarlRingSink::flush(void)
+{
+}
+
+std::string HarlRingSink::contents(void) const
+{
+    std::size_t size;
+    std::size_t pos;
+
+    size = ring.size();
+    if (total <= size)
+        return std::string(&ring[0], total);
+    pos = total % size;
+    return std::string(&ring[pos], size - pos) + std::string(&ring[0], pos);
+}
+
+unsigned long long HarlRingSink::bytesWritten(void) const
+{
+    return total;
+}
+
+void HarlRingSink::clear(void)
+{
+    total = 0;
+}
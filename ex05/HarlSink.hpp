@@ -0,0 +1,104 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   HarlSink.hpp                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: marvin <marvin@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 15:48:05 by marvin            #+#    #+#             */
+/*   Updated: 2026/10/18 12:47:15 by marvin           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef HARLSINK_HPP
+#define HARLSINK_HPP
+
+#include <string>
+#include <vector>
+#include <cstddef>
+#include "Harl.hpp"
+
+class HarlSink
+{
+   private:
+      std::string    scratch;
+
+   public:
+      virtual ~HarlSink();
+
+      virtual void   write(const char* data, std::size_t len) = 0;
+      virtual void   flush(void) = 0;
+
+      void           record(Harl::Level level);
+};
+
+// Collects writes in a user-space buffer and hands them to fd in one
+// write() when it fills or on flush(). Output goes straight to the fd, so
+// anything still sitting in std::cout's buffer may come out after it.
+class HarlFdSink : public HarlSink
+{
+   protected:
+      int            fd;
+      bool           owns_fd;
+      std::string    buffer;
+      std::size_t    capacity;
+
+   private:
+      HarlFdSink(const HarlFdSink&);
+      HarlFdSink& operator=(const HarlFdSink&);
+
+   public:
+      HarlFdSink(int fd = 1, std::size_t capacity = 1 << 20,
+                 bool owns_fd = false);
+      virtual ~HarlFdSink();
+
+      virtual void   write(const char* data, std::size_t len);
+      virtual void   flush(void);
+};
+
+// Appends to path. Once the file would pass max_bytes, or has been open
+// for max_seconds, it is renamed to path.1 (path.1 to path.2 and so on,
+// up to keep) and a fresh file is started. Zero disables a limit.
+class HarlFileSink : public HarlFdSink
+{
+   private:
+      std::string          path;
+      unsigned long long   max_bytes;
+      unsigned long long   max_ns;
+      unsigned int         keep;
+      unsigned long long   written;
+      unsigned long long   opened_ns;
+
+      bool  open(bool truncate);
+      void  rotate(void);
+
+   public:
+      HarlFileSink(const std::string& path,
+                   unsigned long long max_bytes = 0,
+                   unsigned int max_seconds = 0,
+                   unsigned int keep = 5,
+                   std::size_t capacity = 1 << 20);
+
+      bool           isOpen(void) const;
+      virtual void   write(const char* data, std::size_t len);
+};
+
+// Keeps the last capacity bytes written, for checking output in tests.
+class HarlRingSink : public HarlSink
+{
+   private:
+      std::vector<char>    ring;
+      unsigned long long   total;
+
+   public:
+      HarlRingSink(std::size_t capacity = 64 * 1024);
+
+      virtual void   write(const char* data, std::size_t len);
+      virtual void   flush(void);
+
+      std::string          contents(void) const;
+      unsigned long long   bytesWritten(void) const;
+      void                 clear(void);
+};
+
+#endif
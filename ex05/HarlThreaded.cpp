@@ -0,0 +1,154 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   HarlThreaded.cpp                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: marvin <marvin@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 14:37:19 by marvin            #+#    #+#             */
+/*   Updated: 2026/10/18 12:30:41 by marvin           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "HarlThreaded.hpp"
+#include <climits>
+#include <sys/stat.h>
+
+// Every thread formats into its own buffer and hands whole batches to the
+// sink with a single write(), so records never interleave mid-line and no
+// lock is taken on the logging path. A write to a pipe is only atomic up
+// to PIPE_BUF bytes, so on a pipe or FIFO batches are cut at the last
+// record boundary below that size. Buffers are also kept in a registry so
+// the destructor can flush the calling thread's own buffer.
+HarlThreaded::HarlThreaded(int fd, bool sequenced, std::size_t flush_bytes)
+    : fd(fd), sequenced(sequenced), flush_bytes(flush_bytes),
+      atomic_bytes(0), sequence(0)
+{
+    struct stat st;
+
+    if (fstat(fd, &st) == 0 && S_ISFIFO(st.st_mode))
+        atomic_bytes = PIPE_BUF;
+    pthread_key_create(&key, &HarlThreaded::retireBuffer);
+    pthread_mutex_init(&registry_lock, NULL);
+}
+
+HarlThreaded::~HarlThreaded()
+{
+    std::size_t i;
+
+    pthread_mutex_lock(&registry_lock);
+    i = 0;
+    while (i < registry.size())
+    {
+        flushBuffer(registry[i]);
+        delete registry[i];
+        i++;
+    }
+    registry.clear();
+    pthread_mutex_unlock(&registry_lock);
+    pthread_setspecific(key, NULL);
+    pthread_key_delete(key);
+    pthread_mutex_destroy(&registry_lock);
+}
+
+HarlThreaded::ThreadBuffer* HarlThreaded::localBuffer(void)
+{
+    ThreadBuffer* buffer;
+
+    buffer = static_cast<ThreadBuffer*>(pthread_getspecific(key));
+    if (buffer)
+        return buffer;
+    buffer = new ThreadBuffer;
+    buffer->owner = this;
+    buffer->data.reserve(flush_bytes + 512);
+    pthread_setspecific(key, buffer);
+    pthread_mutex_lock(&registry_lock);
+    registry.push_back(buffer);
+    pthread_mutex_unlock(&registry_lock);
+    return buffer;
+}
+
+void HarlThreaded::flushBuffer(ThreadBuffer* buffer)
+{
+    if (buffer->data.empty())
+        return;
+    harl_write_all(fd, buffer->data.data(), buffer->data.length());
+    buffer->data.clear();
+}
+
+// Runs on thread exit: the last records of that thread go out before its
+// buffer is freed.
+void HarlThreaded::retireBuffer(void* raw)
+{
+    ThreadBuffer*   buffer;
+    HarlThreaded*   owner;
+    std::size_t     i;
+
+    buffer = static_cast<ThreadBuffer*>(raw);
+    owner = buffer->owner;
+    pthread_mutex_lock(&owner->registry_lock);
+    owner->flushBuffer(buffer);
+    i = 0;
+    while (i < owner->registry.size() && owner->registry[i] != buffer)
+        i++;
+    if (i < owner->registry.size())
+        owner->registry.erase(owner->registry.begin() + i);
+    pthread_mutex_unlock(&owner->registry_lock);
+    delete buffer;
+}
+
+static void append_sequence(std::string& out, unsigned long n)
+{
+    char    digits[24];
+    int     i;
+
+    i = sizeof(digits);
+    do
+    {
+        digits[--i] = static_cast<char>('0' + n % 10);
+        n /= 10;
+    } while (n > 0);
+    digits[--i] = '#';
+    out.append(digits + i, sizeof(digits) - i);
+    out += ' ';
+}
+
+// With sequencing on, each record is prefixed by a global "#<n> " taken
+// from one atomic counter, so a reader can restore the order across threads.
+void HarlThreaded::complain(Harl::Level level)
+{
+    ThreadBuffer*   buffer;
+    std::size_t     start;
+
+    if (!Harl::isEnabled(level) || level >= Harl::LEVEL_COUNT)
+        return;
+    buffer = localBuffer();
+    start = buffer->data.length();
+    if (sequenced)
+        append_sequence(buffer->data,
+                        __atomic_fetch_add(&sequence, 1, __ATOMIC_RELAXED));
+    Harl::format(level, buffer->data);
+    if (atomic_bytes && buffer->data.length() > atomic_bytes && start > 0)
+    {
+        harl_write_all(fd, buffer->data.data(), start);
+        buffer->data.erase(0, start);
+    }
+    if (buffer->data.length() >= flush_bytes
+        || (atomic_bytes && buffer->data.length() >= atomic_bytes))
+        flushBuffer(buffer);
+}
+
+void HarlThreaded::complain(const std::string& level)
+{
+    complain(Harl::levelFromString(level));
+}
+
+// Flushes the calling thread's buffer only.
+void HarlThreaded::flush(void)
+{
+    ThreadBuffer* buffer;
+
+    buffer = static_cast<ThreadBuffer*>(pthread_getspecific(key));
+    if (buffer)
+        flushBuffer(buffer);
+}
@@ -0,0 +1,61 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   HarlThreaded.hpp                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: marvin <marvin@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 14:37:19 by marvin            #+#    #+#             */
+/*   Updated: 2026/10/18 12:30:41 by marvin           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef HARLTHREADED_HPP
+#define HARLTHREADED_HPP
+
+#include <string>
+#include <vector>
+#include <cstddef>
+#include <pthread.h>
+#include "Harl.hpp"
+
+// Every thread that logged through a HarlThreaded, other than the one
+// destroying it, must have exited (been joined) before the destructor
+// runs: their buffers are flushed and freed on thread exit, and a thread
+// still running would be left holding a freed buffer.
+class HarlThreaded
+{
+   private:
+      struct ThreadBuffer
+      {
+         HarlThreaded*  owner;
+         std::string    data;
+      };
+
+      int                        fd;
+      bool                       sequenced;
+      std::size_t                flush_bytes;
+      std::size_t                atomic_bytes;
+      unsigned long              sequence;
+      pthread_key_t              key;
+      pthread_mutex_t            registry_lock;
+      std::vector<ThreadBuffer*> registry;
+
+      HarlThreaded(const HarlThreaded&);
+      HarlThreaded& operator=(const HarlThreaded&);
+
+      ThreadBuffer*  localBuffer(void);
+      void           flushBuffer(ThreadBuffer* buffer);
+      static void    retireBuffer(void* buffer);
+
+   public:
+      HarlThreaded(int fd = 1, bool sequenced = false,
+                   std::size_t flush_bytes = 16 * 1024);
+      ~HarlThreaded();
+
+      void  complain(Harl::Level level);
+      void  complain(const std::string& level);
+      void  flush(void);
+};
+
+#endif
@@ -0,0 +1,291 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   harlbench.cpp                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: marvin <marvin@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 10:14:02 by marvin            #+#    #+#             */
+/*   Updated: 2026/10/18 15:31:40 by marvin           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../bench/Harness.hpp"
+#include "../Harl.hpp"
+#include "../HarlAsync.hpp"
+#include "../HarlThreaded.hpp"
+#include "../HarlBinary.hpp"
+#include "../HarlSink.hpp"
+#include <iostream>
+#include <cstdio>
+#include <vector>
+#include <pthread.h>
+
+// The lookup Harl::complain used before: a local string table rebuilt and
+// scanned on every call.
+static int legacy_lookup(std::string level)
+{
+    std::string levels[4] = {
+        "DEBUG",
+        "INFO",
+        "WARNING",
+        "ERROR"
+    };
+
+    int i = 0;
+    while (i < 4)
+    {
+        if (level == levels[i])
+            return i;
+        i++;
+    }
+    return -1;
+}
+
+// Cycles through four levels and one name that is not a level.
+struct HarlCase
+{
+    Harl            harl;
+    HarlAsync*      async;
+    HarlBinary*     binary;
+    std::string     inputs[5];
+    unsigned long   i;
+    long            sink;
+};
+
+static void lookup_legacy(void* ctx)
+{
+    HarlCase* c;
+
+    c = static_cast<HarlCase*>(ctx);
+    c->sink += legacy_lookup(c->inputs[++c->i % 5]);
+}
+
+static void lookup_level(void* ctx)
+{
+    HarlCase* c;
+
+    c = static_cast<HarlCase*>(ctx);
+    c->sink += Harl::levelFromString(c->inputs[++c->i % 5]);
+}
+
+static void complain_string(void* ctx)
+{
+    HarlCase* c;
+
+    c = static_cast<HarlCase*>(ctx);
+    c->harl.complain(c->inputs[++c->i % 5]);
+}
+
+static void complain_level(void* ctx)
+{
+    HarlCase* c;
+
+    c = static_cast<HarlCase*>(ctx);
+    c->harl.complain(static_cast<Harl::Level>(++c->i % 4));
+}
+
+static void complain_debug(void* ctx)
+{
+    static_cast<HarlCase*>(ctx)->harl.complain(Harl::DEBUG);
+}
+
+static void complain_async(void* ctx)
+{
+    HarlCase* c;
+
+    c = static_cast<HarlCase*>(ctx);
+    c->async->complain(static_cast<Harl::Level>(++c->i % 4));
+}
+
+static void complain_binary(void* ctx)
+{
+    HarlCase* c;
+
+    c = static_cast<HarlCase*>(ctx);
+    c->binary->complain(static_cast<Harl::Level>(++c->i % 4));
+}
+
+struct ScalingArg
+{
+    HarlThreaded*       threaded;
+    pthread_mutex_t*    lock;
+    int                 fd;
+    unsigned long       calls;
+    void*               (*worker)(void*);
+    unsigned int        threads;
+    bool                failed;
+};
+
+// Baseline for the scaling test: what a naive thread-safe logger does, one
+// lock and one write() per record.
+static void* locked_worker(void* raw)
+{
+    ScalingArg*     arg;
+    std::string     line;
+    unsigned long   i;
+
+    arg = static_cast<ScalingArg*>(raw);
+    i = 0;
+    while (i < arg->calls)
+    {
+        line.clear();
+        Harl::format(static_cast<Harl::Level>(i % 4), line);
+        pthread_mutex_lock(arg->lock);
+        harl_write_all(arg->fd, line.data(), line.length());
+        pthread_mutex_unlock(arg->lock);
+        i++;
+    }
+    return NULL;
+}
+
+static void* threaded_worker(void* raw)
+{
+    ScalingArg*     arg;
+    unsigned long   i;
+
+    arg = static_cast<ScalingArg*>(raw);
+    i = 0;
+    while (i < arg->calls)
+    {
+        arg->threaded->complain(static_cast<Harl::Level>(i % 4));
+        i++;
+    }
+    return NULL;
+}
+
+// Joins whatever was started; a thread that could not be created marks
+// the case as failed, since its timing covers less work than reported.
+static void run_threads(void* ctx)
+{
+    ScalingArg*             arg;
+    std::vector<pthread_t>  tids;
+    unsigned int            started;
+    unsigned int            i;
+
+    arg = static_cast<ScalingArg*>(ctx);
+    tids.resize(arg->threads);
+    started = 0;
+    while (started < arg->threads
+           && pthread_create(&tids[started], NULL, arg->worker, arg) == 0)
+        started++;
+    if (started < arg->threads)
+        arg->failed = true;
+    i = 0;
+    while (i < started)
+    {
+        pthread_join(tids[i], NULL);
+        i++;
+    }
+}
+
+// The sinks write to fd 1, which the harness points at /dev/null. --calls N
+// (1000000 by default) is the number of records one call of a scaling
+// case logs across all of its threads.
+int main(int ac, char **av)
+{
+    static const char*  names[] = {"DEBUG", "INFO", "WARNING", "ERROR", "NOPE"};
+    static const unsigned int thread_counts[] = {1, 4, 16, 64};
+    Harness             harness("harlbench", ac, av);
+    HarlCase            c;
+    unsigned long       calls;
+    unsigned long       i;
+    pthread_mutex_t     lock;
+    ScalingArg          arg;
+    char                name[64];
+    std::string         text;
+
+    calls = harness.option("--calls", 1000000);
+    c.i = 0;
+    c.sink = 0;
+    i = 0;
+    while (i < 5)
+    {
+        c.inputs[i] = names[i];
+        i++;
+    }
+
+    harness.run("lookup legacy", &lookup_legacy, &c, 100000);
+    harness.run("lookup levelFromString", &lookup_level, &c, 100000);
+    harness.discardCout(true);
+    harness.run("complain(std::string)", &complain_string, &c, 100000);
+    harness.run("complain(Harl::Level)", &complain_level, &c, 100000);
+    harness.discardCout(false);
+    Harl::setThreshold(Harl::WARNING);
+    harness.run("complain(DEBUG) filtered", &complain_debug, &c, 100000);
+    Harl::setThreshold(Harl::DEBUG);
+    {
+        HarlFdSink fdsink(1);
+
+        c.harl.setSink(&fdsink);
+        harness.run("complain -> HarlFdSink", &complain_level, &c, 100000);
+        c.harl.flush();
+        c.harl.setSink(NULL);
+    }
+    {
+        HarlAsync async(1 << 16, HarlAsync::BLOCK, 1);
+
+        c.async = &async;
+        harness.run("HarlAsync producer (block)", &complain_async, &c,
+                    100000);
+        async.flush();
+    }
+    {
+        HarlAsync async(1 << 16, HarlAsync::DROP_COUNT, 1);
+
+        c.async = &async;
+        harness.run("HarlAsync producer (drop)", &complain_async, &c, 100000);
+        std::cerr << "  dropped " << async.dropped() << "\n";
+    }
+    {
+        HarlBinary binary("/dev/null");
+
+        c.binary = &binary;
+        harness.run("HarlBinary", &complain_binary, &c, 100000);
+        binary.flush();
+        i = 0;
+        while (i < 4)
+        {
+            Harl::format(static_cast<Harl::Level>(i), text);
+            i++;
+        }
+        std::cerr << "  bytes/event text " << text.length() / 4.0
+                  << " binary 8 (" << text.length() / 32.0 << "x)\n";
+    }
+
+    pthread_mutex_init(&lock, NULL);
+    arg.lock = &lock;
+    arg.fd = 1;
+    arg.failed = false;
+    i = 0;
+    while (i < 4)
+    {
+        arg.threads = thread_counts[i];
+        arg.calls = calls / arg.threads;
+        arg.worker = &locked_worker;
+        std::snprintf(name, sizeof(name), "mutex+write   %2u threads",
+                      arg.threads);
+        harness.run(name, &run_threads, &arg, 1, 0,
+                    arg.calls * arg.threads);
+        {
+            HarlThreaded threaded(1, false);
+
+            arg.threaded = &threaded;
+            arg.worker = &threaded_worker;
+            std::snprintf(name, sizeof(name), "HarlThreaded  %2u threads",
+                          arg.threads);
+            harness.run(name, &run_threads, &arg, 1, 0,
+                        arg.calls * arg.threads);
+        }
+        if (arg.failed)
+            break;
+        i++;
+    }
+    pthread_mutex_destroy(&lock);
+    if (arg.failed)
+    {
+        std::cerr << "Error: cannot start " << arg.threads << " threads\n";
+        return 1;
+    }
+    return harness.finish();
+}
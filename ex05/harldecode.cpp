@@ -0,0 +1,44 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   harldecode.cpp                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: marvin <marvin@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 15:12:40 by marvin            #+#    #+#             */
+/*   Updated: 2026/10/17 15:12:40 by marvin           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "HarlBinary.hpp"
+#include <iostream>
+#include <fcntl.h>
+#include <unistd.h>
+
+int main(int ac, char **av)
+{
+    bool    annotate;
+    bool    ok;
+    int     fd;
+
+    annotate = (ac == 3 && std::string(av[1]) == "-t");
+    if (ac != 2 && !annotate)
+    {
+        std::cout << "Usage: ./harldecode [-t] <binary log>\n";
+        return 1;
+    }
+    fd = open(av[ac - 1], O_RDONLY);
+    if (fd < 0)
+    {
+        std::cout << "Error: cannot open " << av[ac - 1] << "\n";
+        return 1;
+    }
+    ok = harl_decode(fd, 1, annotate);
+    close(fd);
+    if (!ok)
+    {
+        std::cerr << "Error: " << av[ac - 1] << " is not a valid Harl log\n";
+        return 1;
+    }
+    return 0;
+}